@@ -0,0 +1,196 @@
+/*
+    Disciplina: Projeto e Análise de Algoritmos
+    Turma: S73
+    UTFPR - Curitiba
+
+    Alunos:
+        Diego Henrique Arenas Okawa - 2127890
+        Louis Brommelstroet - 2127997
+        Ellejeane Camila Marques Ferreira dos Santos - 1904965
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "tsp.h"
+
+#define LIMIAR_PARALELO 100000
+#define MAXIMO_THREADS 256
+
+static void somarCompensado(double *soma, double *compensacao, double valor);
+static double distanciaPosicoes(Ponto pontos[], int ciclo[], int tam, int i, int j);
+
+/*Função que calcula o custo total de um ciclo. Possui um vetor de pontos, um vetor de ciclo e um tamanho como entrada. São lidas apenas
+as tam primeiras posições do ciclo e a última aresta volta para ciclo[0], então tanto o ciclo fechado (tam + 1 posições, como o gerado
+pela busca em profundidade) quanto o aberto dão o mesmo resultado. A soma é compensada (Kahan-Babuška), para não acumular erro de
+arredondamento em instâncias grandes, e, com OpenMP, instâncias com pelo menos LIMIAR_PARALELO vértices são divididas entre as threads.
+As parcelas de cada thread são combinadas sempre na mesma ordem, então o resultado só depende do número de threads.*/
+double calcularCustoCiclo(Ponto pontos[], int ciclo[], int tam){
+
+    double somas[MAXIMO_THREADS], compensacoes[MAXIMO_THREADS], soma = 0, compensacao = 0;
+    int usadas = 1;
+
+    if(tam < 2)
+        return 0;
+
+#ifdef _OPENMP
+    int threads = 1;
+
+    if(tam >= LIMIAR_PARALELO)
+        threads = (omp_get_max_threads() < MAXIMO_THREADS) ? omp_get_max_threads() : MAXIMO_THREADS;
+
+    #pragma omp parallel num_threads(threads) if(threads > 1)
+#endif
+    {
+        int thread = 0, quantidade = 1;
+        double parcial = 0, erro = 0;
+
+#ifdef _OPENMP
+        thread = omp_get_thread_num();
+        quantidade = omp_get_num_threads();
+#endif
+
+        int inicio = (int) ((long long) tam * thread / quantidade);
+        int fim = (int) ((long long) tam * (thread + 1) / quantidade);
+
+        for(int i = inicio; i < fim; i++)
+            somarCompensado(&parcial, &erro, calcularDistanciaPontos(pontos[ciclo[i]], pontos[ciclo[(i + 1 < tam) ? i + 1 : 0]]));
+
+        somas[thread] = parcial;
+        compensacoes[thread] = erro;
+
+        if(thread == 0)
+            usadas = quantidade;
+    }
+
+    for(int i = 0; i < usadas; i++){
+
+        somarCompensado(&soma, &compensacao, somas[i]);
+        somarCompensado(&soma, &compensacao, compensacoes[i]);
+
+    }
+
+    return soma + compensacao;
+
+}
+
+/*Função que verifica em O(n) se um ciclo é uma permutação válida. O ciclo deve ter tam + 1 posições, com a última repetindo a primeira,
+e cada uma das tam primeiras posições deve guardar um vértice diferente no intervalo [0, vertices). O vetor marcas, com pelo menos
+vertices posições, é usado como rascunho (pode ser o vetor visitados de um espaço de trabalho). Retorna 1 caso o ciclo seja válido e
+0 caso contrário.*/
+int validarCiclo(int ciclo[], int tam, int vertices, char marcas[]){
+
+    if(tam < 1 || tam > vertices || ciclo[tam] != ciclo[0])
+        return 0;
+
+    memset(marcas, 0, vertices * sizeof (char));
+
+    for(int i = 0; i < tam; i++){
+
+        if(ciclo[i] < 0 || ciclo[i] >= vertices || marcas[ciclo[i]])
+            return 0;
+
+        marcas[ciclo[i]] = 1;
+
+    }
+
+    return 1;
+
+}
+
+/*Função que calcula em O(1) a variação de custo de um movimento 2-opt. As arestas que saem das posições i e j do ciclo,
+(ciclo[i], ciclo[i + 1]) e (ciclo[j], ciclo[j + 1]), são trocadas por (ciclo[i], ciclo[j]) e (ciclo[i + 1], ciclo[j + 1]), o que
+equivale a inverter o trecho circular que vai de ciclo[i + 1] até ciclo[j]. As posições são tomadas módulo tam e podem vir em qualquer
+ordem (com j < i, o trecho dá a volta no ciclo), desde que as duas arestas sejam diferentes e não vizinhas. Um valor negativo indica que o
+movimento melhora o ciclo.*/
+double deltaDoisOpt(Ponto pontos[], int ciclo[], int tam, int i, int j){
+
+    return distanciaPosicoes(pontos, ciclo, tam, i, j) + distanciaPosicoes(pontos, ciclo, tam, i + 1, j + 1)
+         - distanciaPosicoes(pontos, ciclo, tam, i, i + 1) - distanciaPosicoes(pontos, ciclo, tam, j, j + 1);
+
+}
+
+/*Função que calcula em O(1) a variação de custo de um movimento Or-opt. O trecho de comprimento posições que começa na posição i é
+retirado do ciclo e reinserido entre as posições j e j + 1 (j não pode pertencer ao trecho nem ser a posição anterior a ele). Caso
+invertido seja diferente de 0, o trecho é reinserido em ordem inversa. Um valor negativo indica que o movimento melhora o ciclo.*/
+double deltaOrOpt(Ponto pontos[], int ciclo[], int tam, int i, int comprimento, int j, int invertido){
+
+    int primeiro = i, ultimo = i + comprimento - 1;
+    double removido, adicionado;
+
+    removido = distanciaPosicoes(pontos, ciclo, tam, primeiro - 1 + tam, primeiro)
+             + distanciaPosicoes(pontos, ciclo, tam, ultimo, ultimo + 1)
+             + distanciaPosicoes(pontos, ciclo, tam, j, j + 1);
+
+    adicionado = distanciaPosicoes(pontos, ciclo, tam, primeiro - 1 + tam, ultimo + 1);
+
+    if(invertido)
+        adicionado += distanciaPosicoes(pontos, ciclo, tam, j, ultimo) + distanciaPosicoes(pontos, ciclo, tam, primeiro, j + 1);
+
+    else
+        adicionado += distanciaPosicoes(pontos, ciclo, tam, j, primeiro) + distanciaPosicoes(pontos, ciclo, tam, ultimo, j + 1);
+
+    return adicionado - removido;
+
+}
+
+/*Função que calcula em O(1) a variação de custo de trocar os vértices das posições i e j do ciclo. Quando as posições são vizinhas,
+apenas as duas arestas externas mudam. Um valor negativo indica que o movimento melhora o ciclo.*/
+double deltaTroca(Ponto pontos[], int ciclo[], int tam, int i, int j){
+
+    i %= tam;
+    j %= tam;
+
+    //Com até três vértices, qualquer troca gera o mesmo ciclo.
+    if(i == j || tam < 4)
+        return 0;
+
+    if((j + 1) % tam == i){
+
+        int aux = i;
+        i = j;
+        j = aux;
+
+    }
+
+    //Posições vizinhas: (a, i, j, b) passa a ser (a, j, i, b).
+    if((i + 1) % tam == j)
+        return distanciaPosicoes(pontos, ciclo, tam, i - 1 + tam, j) + distanciaPosicoes(pontos, ciclo, tam, i, j + 1)
+             - distanciaPosicoes(pontos, ciclo, tam, i - 1 + tam, i) - distanciaPosicoes(pontos, ciclo, tam, j, j + 1);
+
+    double removido = distanciaPosicoes(pontos, ciclo, tam, i - 1 + tam, i) + distanciaPosicoes(pontos, ciclo, tam, i, i + 1)
+                    + distanciaPosicoes(pontos, ciclo, tam, j - 1 + tam, j) + distanciaPosicoes(pontos, ciclo, tam, j, j + 1);
+    double adicionado = distanciaPosicoes(pontos, ciclo, tam, i - 1 + tam, j) + distanciaPosicoes(pontos, ciclo, tam, j, i + 1)
+                      + distanciaPosicoes(pontos, ciclo, tam, j - 1 + tam, i) + distanciaPosicoes(pontos, ciclo, tam, i, j + 1);
+
+    return adicionado - removido;
+
+}
+
+/*Função que soma um valor a uma soma compensada (variante de Neumaier do algoritmo de Kahan). A compensação guarda o erro de arredondamento
+acumulado e deve ser somada ao resultado final.*/
+static void somarCompensado(double *soma, double *compensacao, double valor){
+
+    double t = *soma + valor;
+
+    if(fabs(*soma) >= fabs(valor))
+        *compensacao += (*soma - t) + valor;
+
+    else
+        *compensacao += (valor - t) + *soma;
+
+    *soma = t;
+
+}
+
+/*Função que retorna a distância entre os vértices das posições i e j do ciclo. As posições são tomadas módulo tam.*/
+static double distanciaPosicoes(Ponto pontos[], int ciclo[], int tam, int i, int j){
+
+    return calcularDistanciaPontos(pontos[ciclo[i % tam]], pontos[ciclo[j % tam]]);
+
+}
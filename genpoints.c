@@ -1,16 +1,36 @@
 #include<stdio.h>
 #include<stdlib.h>
+#include<stdint.h>
 #include<ctype.h>
 #include<string.h>
-#include<time.h>
+#include<errno.h>
+#include<unistd.h>
+#include<math.h>
 
 #define MAX_XAXIS 1024
 #define MAX_YAXIS 1024
-#define MAX_POINTS MAX_XAXIS*MAX_YAXIS
+#define MAX_BITMAP (1ULL << 32)
+#define DENSIDADE_ORDENADA 8
+#define TAM_BUFFER (1 << 20)
+#define MAGICO_BINARIO "TSPBIN1"
+
+/* Formato binario: 8 bytes com MAGICO_BINARIO (incluindo o '\0'), um int64_t com o nro de pontos
+ * e, em seguida, os pontos como pares de double (x, y), na ordem de bytes da maquina. */
+
+/* Distribuicoes suportadas. */
+enum { UNIFORME, GAUSS, CLUSTER, GRADE };
+
+/* Estado do gerador xoshiro256**. */
+typedef struct { uint64_t s[4]; int temNormal; double normal; } Gerador;
+
+/* Saida bufferizada. */
+typedef struct { FILE *fp; char *buf; size_t usado; } Saida;
 
 /* Funcao para verificar se argumento eh inteiro positivo. */
 int ehInteiroPositivo(char number[])
 {
+    if (number[0] == '\0')
+        return 0;
     for (int i = 0; number[i] != '\0'; i++)
     {
         if (!isdigit(number[i]))
@@ -19,63 +39,527 @@ int ehInteiroPositivo(char number[])
     return 1;
 }
 
+/* Funcao splitmix64, usada para espalhar a semente pelos 256 bits do estado. */
+uint64_t splitmix64(uint64_t *x)
+{
+    uint64_t z = (*x += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+void semear(Gerador *g, uint64_t semente)
+{
+    for (int i = 0; i < 4; i++)
+        g->s[i] = splitmix64(&semente);
+    g->temNormal = 0;
+}
+
+static inline uint64_t rotl(uint64_t x, int k)
+{
+    return (x << k) | (x >> (64 - k));
+}
+
+/* Proximo numero do xoshiro256**. */
+static inline uint64_t proximo(Gerador *g)
+{
+    uint64_t *s = g->s;
+    uint64_t resultado = rotl(s[1] * 5, 7) * 9;
+    uint64_t t = s[1] << 17;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotl(s[3], 45);
+    return resultado;
+}
+
+/* Real uniforme em [0, 1). */
+static inline double uniforme01(Gerador *g)
+{
+    return (proximo(g) >> 11) * 0x1.0p-53;
+}
+
+/* Inteiro uniforme em [0, limite) sem o vies do modulo (multiplicacao de Lemire). */
+static inline uint64_t uniformeInt(Gerador *g, uint64_t limite)
+{
+    return (uint64_t)(((unsigned __int128)proximo(g) * limite) >> 64);
+}
+
+/* Normal padrao pelo metodo de Box-Muller (cada sorteio gera dois valores). */
+double normal(Gerador *g)
+{
+    if (g->temNormal)
+    {
+        g->temNormal = 0;
+        return g->normal;
+    }
+    double u1 = 1.0 - uniforme01(g);
+    double u2 = uniforme01(g);
+    double r = sqrt(-2.0 * log(u1));
+    g->normal = r * sin(2.0 * M_PI * u2);
+    g->temNormal = 1;
+    return r * cos(2.0 * M_PI * u2);
+}
+
+/* Esvazia o buffer de saida no arquivo. */
+int descarregar(Saida *saida)
+{
+    if (saida->usado > 0 && fwrite(saida->buf, 1, saida->usado, saida->fp) != saida->usado)
+        return 0;
+    saida->usado = 0;
+    return 1;
+}
+
+/* Garante espaco para mais n bytes no buffer. */
+static inline int reservar(Saida *saida, size_t n)
+{
+    if (saida->usado + n > TAM_BUFFER)
+        return descarregar(saida);
+    return 1;
+}
+
+/* Pares de digitos de 00 a 99, para converter dois digitos por divisao. */
+static const char DIGITOS[] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+/* Escreve um inteiro sem sinal em decimal no buffer, com pelo menos 'minimo' digitos (mais rapido que fprintf). */
+static inline void escreverDigitos(Saida *saida, unsigned long long v, int minimo)
+{
+    char tmp[24];
+    int n = sizeof(tmp);
+    while (v >= 100)
+    {
+        int par = (int)(v % 100) * 2;
+        v /= 100;
+        tmp[--n] = DIGITOS[par + 1];
+        tmp[--n] = DIGITOS[par];
+    }
+    if (v >= 10)
+    {
+        tmp[--n] = DIGITOS[v * 2 + 1];
+        tmp[--n] = DIGITOS[v * 2];
+    }
+    else
+        tmp[--n] = '0' + v;
+    while ((int)sizeof(tmp) - n < minimo)
+        tmp[--n] = '0';
+    memcpy(saida->buf + saida->usado, tmp + n, sizeof(tmp) - n);
+    saida->usado += sizeof(tmp) - n;
+}
+
+/* Escreve um inteiro em decimal no buffer. */
+static inline void escreverInt(Saida *saida, long long valor)
+{
+    if (valor < 0)
+    {
+        saida->buf[saida->usado++] = '-';
+        escreverDigitos(saida, -(unsigned long long)valor, 1);
+    }
+    else
+        escreverDigitos(saida, valor, 1);
+}
+
+/* Escreve um real em ponto fixo com 'casas' casas decimais. */
+static inline void escreverReal(Saida *saida, double valor, int casas, long long escala)
+{
+    if (valor < 0)
+    {
+        saida->buf[saida->usado++] = '-';
+        valor = -valor;
+    }
+    unsigned long long fixo = (unsigned long long)(valor * escala + 0.5);
+    escreverDigitos(saida, fixo / escala, 1);
+    if (casas > 0)
+    {
+        saida->buf[saida->usado++] = '.';
+        escreverDigitos(saida, fixo % escala, casas);
+    }
+}
+
+/* Le um inteiro em [min, max]. */
+int lerInteiro(char *arg, long min, long max, int *valor)
+{
+    char *fim;
+    errno = 0;
+    long lido = strtol(arg, &fim, 10);
+    if (fim == arg || *fim != '\0' || errno != 0 || lido < min || lido > max)
+        return 0;
+    *valor = (int)lido;
+    return 1;
+}
+
+/* Le a semente (inteiro sem sinal de 64 bits). */
+int lerSemente(char *arg, uint64_t *semente)
+{
+    char *fim;
+    if (!isdigit((unsigned char)arg[0]))
+        return 0;
+    errno = 0;
+    *semente = strtoull(arg, &fim, 10);
+    return *fim == '\0' && errno == 0;
+}
+
+/* Sorteia n celulas distintas de [0, total) com densidade alta (n >= total / DENSIDADE_ORDENADA). As celulas sao percorridas em ordem
+ * e cada uma eh escolhida com probabilidade faltam / restantes (algoritmo S de Knuth), sem os acessos aleatorios da rejeicao num mapa
+ * de bits; depois o vetor eh embaralhado (Fisher-Yates) para que os pontos saiam em ordem aleatoria. Retorna NULL se faltar memoria. */
+uint32_t *sortearCelulas(Gerador *g, uint64_t total, uint64_t n)
+{
+    uint32_t *celulas = malloc(n * sizeof(uint32_t));
+    if (celulas == NULL)
+        return NULL;
+    uint64_t escolhidas = 0;
+    for (uint64_t celula = 0; escolhidas < n; celula++)
+    {
+        if (uniformeInt(g, total - celula) < n - escolhidas)
+            celulas[escolhidas++] = (uint32_t)celula;
+    }
+    for (uint64_t i = n; i > 1; i--)
+    {
+        uint64_t j = uniformeInt(g, i);
+        uint32_t aux = celulas[i - 1];
+        celulas[i - 1] = celulas[j];
+        celulas[j] = aux;
+    }
+    return celulas;
+}
+
+/* Le dois valores separados por virgula (ex.: "0,1024"). */
+int lerIntervalo(char *arg, double *min, double *max)
+{
+    char *fim;
+    *min = strtod(arg, &fim);
+    if (*fim != ',')
+        return 0;
+    *max = strtod(fim + 1, &fim);
+    return *fim == '\0' && *max > *min;
+}
+
+void uso(char *programa)
+{
+    fprintf(stderr,
+        "Uso: %s [opcoes] nro_pontos\n"
+        "  -o arquivo   arquivo de saida (padrao input.txt, '-' para a saida padrao)\n"
+        "  -s semente   semente do gerador (padrao 1)\n"
+        "  -d dist      uniforme, gauss, cluster ou grade (padrao uniforme)\n"
+        "  -x min,max   intervalo do eixo X (padrao 0,%d)\n"
+        "  -y min,max   intervalo do eixo Y (padrao 0,%d)\n"
+        "  -k nro       nro de clusters (cluster) ou de ruas por eixo (grade) (padrao 10)\n"
+        "  -r           coordenadas reais em vez de inteiras\n"
+        "  -p casas     casas decimais das coordenadas reais em texto (padrao 3)\n"
+        "  -b           saida no formato binario\n"
+        "  -u           permite pontos inteiros repetidos na distribuicao uniforme\n",
+        programa, MAX_XAXIS, MAX_YAXIS);
+}
+
 int main(int argc, char *argv[]){
 
-	/* Verifica argumento. */
-	if (argc != 2)
+	/* Parametros padrao (equivalentes ao gerador original, mas com semente fixa). */
+	char *nomeArquivo = "input.txt";
+	uint64_t semente = 1;
+	int distribuicao = UNIFORME;
+	double xmin = 0, xmax = MAX_XAXIS, ymin = 0, ymax = MAX_YAXIS;
+	int k = 10, reais = 0, casas = 3, binario = 0, repetidos = 0;
+	int opcao;
+
+	/* Verifica argumentos. */
+	while ((opcao = getopt(argc, argv, "o:s:d:x:y:k:rp:bu")) != -1)
+	{
+		switch (opcao)
+		{
+		case 'o': nomeArquivo = optarg; break;
+		case 's':
+			if (!lerSemente(optarg, &semente))
+			{
+				fprintf(stderr, "semente (%s) nao eh valida.\n", optarg);
+				return 1;
+			}
+			break;
+		case 'd':
+			if (!strcmp(optarg, "uniforme")) distribuicao = UNIFORME;
+			else if (!strcmp(optarg, "gauss")) distribuicao = GAUSS;
+			else if (!strcmp(optarg, "cluster")) distribuicao = CLUSTER;
+			else if (!strcmp(optarg, "grade")) distribuicao = GRADE;
+			else
+			{
+				fprintf(stderr, "distribuicao (%s) nao eh valida.\n", optarg);
+				return 1;
+			}
+			break;
+		case 'x':
+			if (!lerIntervalo(optarg, &xmin, &xmax))
+			{
+				fprintf(stderr, "intervalo X (%s) nao eh valido.\n", optarg);
+				return 1;
+			}
+			break;
+		case 'y':
+			if (!lerIntervalo(optarg, &ymin, &ymax))
+			{
+				fprintf(stderr, "intervalo Y (%s) nao eh valido.\n", optarg);
+				return 1;
+			}
+			break;
+		case 'k':
+			if (!lerInteiro(optarg, 1, 1 << 24, &k))
+			{
+				fprintf(stderr, "nro de clusters ou ruas (%s) nao eh valido.\n", optarg);
+				return 1;
+			}
+			break;
+		case 'r': reais = 1; break;
+		case 'p':
+			if (!lerInteiro(optarg, 0, 9, &casas))
+			{
+				fprintf(stderr, "nro de casas decimais (%s) nao eh valido (0 a 9).\n", optarg);
+				return 1;
+			}
+			break;
+		case 'b': binario = 1; break;
+		case 'u': repetidos = 1; break;
+		default:
+			uso(argv[0]);
+			return 1;
+		}
+	}
+
+	if (optind != argc - 1)
 	{
-		fprintf(stderr, "Uso: %s nro_pontos\n", argv[0]);
+		uso(argv[0]);
 		return 1;
 	}
 
-	if (!ehInteiroPositivo(argv[1]))
+	if (!ehInteiroPositivo(argv[optind]))
 	{
-		fprintf(stderr, "nro de pontos (%s) nao eh valido.\n", argv[1]);
+		fprintf(stderr, "nro de pontos (%s) nao eh valido.\n", argv[optind]);
 		return 1;
 	}
 
 	/* Recupera tamanho. */
-	int npontos = atoi(argv[1]);
-	
-	/* Verifica se esta dentro dos limites dos eixos. */
-	if (npontos > MAX_POINTS)
+	long long npontos = atoll(argv[optind]);
+
+	long long escala = 1;
+	for (int i = 0; i < casas; i++)
+		escala *= 10;
+
+	/* A saida em texto converte as coordenadas para inteiros de 64 bits (em ponto fixo, no caso de reais). */
+	double maiorCoordenada = fmax(fmax(fabs(xmin), fabs(xmax)), fmax(fabs(ymin), fabs(ymax)));
+	if (!binario && maiorCoordenada * (reais ? escala : 1) >= (reais ? 0x1.0p64 : 0x1.0p63))
 	{
-		fprintf(stderr, "nro de pontos deve ser menor do que %d.\n", MAX_POINTS);
+		fprintf(stderr, "coordenadas grandes demais para a saida em texto com %d casas (use -b ou menos casas).\n", reais ? casas : 0);
 		return 1;
 	}
 
-	/* Cria matrix para verificar pontos sorteados. */
-	char pontos[MAX_YAXIS][MAX_XAXIS];
-	memset(pontos, 0, MAX_POINTS*sizeof(char));
+	/* Coordenadas inteiras usam o reticulado [min, max) de cada eixo. */
+	if (!reais)
+	{
+		xmin = ceil(xmin); xmax = ceil(xmax);
+		ymin = ceil(ymin); ymax = ceil(ymax);
+		if (xmax <= xmin || ymax <= ymin)
+		{
+			fprintf(stderr, "intervalo nao contem coordenadas inteiras.\n");
+			return 1;
+		}
+	}
+
+	Gerador g;
+	semear(&g, semente);
+
+	/* Pontos inteiros uniformes sao distintos (como no gerador original): com densidade alta, as celulas do reticulado sao sorteadas
+	 * de uma vez por sortearCelulas(); com densidade baixa, um mapa de bits rejeita as celulas repetidas. */
+	uint64_t largura = 0, altura = 0;
+	unsigned char *ocupados = NULL;
+	uint32_t *celulas = NULL;
+	int distintos = !reais && distribuicao == UNIFORME && !repetidos;
+	if (distintos)
+	{
+		if (xmax - xmin > MAX_BITMAP || ymax - ymin > MAX_BITMAP)
+		{
+			fprintf(stderr, "reticulado grande demais para pontos distintos (use -u ou -r).\n");
+			return 1;
+		}
+		largura = (uint64_t)(xmax - xmin);
+		altura = (uint64_t)(ymax - ymin);
+		if (altura > MAX_BITMAP / largura)
+		{
+			fprintf(stderr, "reticulado grande demais para pontos distintos (use -u ou -r).\n");
+			return 1;
+		}
+		if ((uint64_t)npontos > largura * altura)
+		{
+			fprintf(stderr, "nro de pontos deve ser no maximo %llu.\n", (unsigned long long)(largura * altura));
+			return 1;
+		}
+		if ((uint64_t)npontos * DENSIDADE_ORDENADA >= largura * altura)
+			celulas = sortearCelulas(&g, largura * altura, npontos);
+		else
+			ocupados = calloc((largura * altura + 7) / 8, 1);
+		if (celulas == NULL && ocupados == NULL)
+		{
+			fprintf(stderr, "Falha ao alocar o mapa de pontos.\n");
+			return 1;
+		}
+	}
 
 	/* Salva arquivo de entrada. */
-	FILE *fp = fopen("input.txt", "w");
+	FILE *fp = strcmp(nomeArquivo, "-") ? fopen(nomeArquivo, binario ? "wb" : "w") : stdout;
 	if (fp == NULL)
 	{
-		fprintf(stderr, "Falha ao criar input.txt.\n");
+		fprintf(stderr, "Falha ao criar %s.\n", nomeArquivo);
 		return 1;
 	}
 
+	Saida saida = { fp, malloc(TAM_BUFFER), 0 };
+	if (saida.buf == NULL)
+	{
+		fprintf(stderr, "Falha ao alocar o buffer de saida.\n");
+		return 1;
+	}
+
+	/* Centros dos clusters e desvios das distribuicoes. */
+	double w = xmax - xmin, h = ymax - ymin;
+	double *centros = NULL;
+	if (distribuicao == CLUSTER)
+	{
+		centros = malloc(2 * k * sizeof(double));
+		for (int i = 0; i < k; i++)
+		{
+			centros[2 * i] = xmin + uniforme01(&g) * w;
+			centros[2 * i + 1] = ymin + uniforme01(&g) * h;
+		}
+	}
+	double sigmaCluster = 0.1 / sqrt((double)k);
+	double ruaX = w / k, ruaY = h / k;
+
+	if (binario)
+	{
+		int64_t n = npontos;
+		memcpy(saida.buf, MAGICO_BINARIO, 8);
+		memcpy(saida.buf + 8, &n, sizeof(n));
+		saida.usado = 8 + sizeof(n);
+	}
+	else
+	{
+		escreverInt(&saida, npontos);
+		saida.buf[saida.usado++] = '\n';
+	}
+
 	/* Cria os pontos aleatorios. */
-	int xcontrole = MAX_XAXIS;
-	int ycontrole = MAX_YAXIS; 
-	srand(time(NULL));
-	int n = 1;
-	fprintf(fp, "%d\n", npontos);
-	while (n <= npontos)
+	for (long long n = 0; n < npontos; n++)
 	{
-		int x = (int)(rand()%MAX_XAXIS);
-		int y = (int)(rand()%MAX_YAXIS);
-		
-		if (!pontos[x][y])
+		double x, y;
+
+		switch (distribuicao)
 		{
-			n++;
-			pontos[x][y] = 1;
-			fprintf(fp, "%d %d\n", x, y);
+		case GAUSS:
+			do
+			{
+				x = xmin + w * (0.5 + normal(&g) / 6.0);
+				y = ymin + h * (0.5 + normal(&g) / 6.0);
+			} while (x < xmin || x >= xmax || y < ymin || y >= ymax);
+			break;
+		case CLUSTER:
+		{
+			double *c = &centros[2 * uniformeInt(&g, k)];
+			do
+			{
+				x = c[0] + w * sigmaCluster * normal(&g);
+				y = c[1] + h * sigmaCluster * normal(&g);
+			} while (x < xmin || x >= xmax || y < ymin || y >= ymax);
+			break;
+		}
+		case GRADE:
+			/* Ponto sobre uma rua horizontal ou vertical, com um pequeno deslocamento lateral. */
+			do
+			{
+				if (proximo(&g) >> 63)
+				{
+					x = xmin + (uniformeInt(&g, k) + 0.5) * ruaX + 0.02 * ruaX * normal(&g);
+					y = ymin + uniforme01(&g) * h;
+				}
+				else
+				{
+					x = xmin + uniforme01(&g) * w;
+					y = ymin + (uniformeInt(&g, k) + 0.5) * ruaY + 0.02 * ruaY * normal(&g);
+				}
+			} while (x < xmin || x >= xmax || y < ymin || y >= ymax);
+			break;
+		default:
+			if (celulas != NULL)
+			{
+				x = xmin + celulas[n] % largura;
+				y = ymin + celulas[n] / largura;
+			}
+			else if (distintos)
+			{
+				uint64_t px, py, celula;
+				do
+				{
+					px = uniformeInt(&g, largura);
+					py = uniformeInt(&g, altura);
+					celula = py * largura + px;
+				} while (ocupados[celula >> 3] & (1 << (celula & 7)));
+				ocupados[celula >> 3] |= 1 << (celula & 7);
+				x = xmin + px;
+				y = ymin + py;
+			}
+			else
+			{
+				x = xmin + uniforme01(&g) * w;
+				y = ymin + uniforme01(&g) * h;
+			}
 		}
+
+		if (!reais)
+		{
+			x = floor(x);
+			y = floor(y);
+		}
+
+		if (!reservar(&saida, 64))
+			break;
+
+		if (binario)
+		{
+			memcpy(saida.buf + saida.usado, &x, sizeof(double));
+			memcpy(saida.buf + saida.usado + sizeof(double), &y, sizeof(double));
+			saida.usado += 2 * sizeof(double);
+		}
+		else if (reais)
+		{
+			escreverReal(&saida, x, casas, escala);
+			saida.buf[saida.usado++] = ' ';
+			escreverReal(&saida, y, casas, escala);
+			saida.buf[saida.usado++] = '\n';
+		}
+		else
+		{
+			escreverInt(&saida, (long long)x);
+			saida.buf[saida.usado++] = ' ';
+			escreverInt(&saida, (long long)y);
+			saida.buf[saida.usado++] = '\n';
+		}
+	}
+
+	int ok = descarregar(&saida);
+	if (fp != stdout)
+		ok = (fclose(fp) == 0) && ok;
+	else
+		ok = (fflush(fp) == 0) && ok;
+
+	if (!ok)
+	{
+		fprintf(stderr, "Falha ao escrever %s.\n", nomeArquivo);
+		return 1;
 	}
 
-	fclose(fp);
+	free(saida.buf);
+	free(ocupados);
+	free(celulas);
+	free(centros);
 
 	return 0;
 }
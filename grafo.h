@@ -0,0 +1,28 @@
+/*
+    Disciplina: Projeto e Análise de Algoritmos
+    Turma: S73
+    UTFPR - Curitiba
+
+    Alunos:
+        Diego Henrique Arenas Okawa - 2127890
+        Louis Brommelstroet - 2127997
+        Ellejeane Camila Marques Ferreira dos Santos - 1904965
+*/
+
+#ifndef GRAFO_H
+#define GRAFO_H
+
+#include "tsp.h"
+
+/*Funções internas para grafos, compartilhadas entre os arquivos da biblioteca (e usadas pelos testes). Não fazem parte da interface
+instalada em tsp.h nem são exportadas pela libtsp.*/
+
+int *buscaProfundidade(Grafo *agm, int vertice);
+int removerAresta(int v1, int v2, Grafo *grafo);
+void destruirGrafo(Grafo *grafo);
+void adicionarAresta(int v1, int v2, double peso, Grafo *grafo);
+Grafo *prim(Grafo *grafo, int vertice, Ponto pontos[]);
+Grafo *criarGrafo(int tamanho);
+Grafo *preencherGrafo(Ponto pontos[], int tam);
+
+#endif
@@ -0,0 +1,802 @@
+/*
+    Disciplina: Projeto e Análise de Algoritmos
+    Turma: S73
+    UTFPR - Curitiba
+
+    Alunos:
+        Diego Henrique Arenas Okawa - 2127890
+        Louis Brommelstroet - 2127997
+        Ellejeane Camila Marques Ferreira dos Santos - 1904965
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+#include <assert.h>
+
+#include "tsp.h"
+#include "grafo.h"
+
+#define CAPACIDADE_MINIMA 16
+#define MAXIMO_TROCAS_LOCAIS 64
+#define JANELA_LOCAL 50
+#define EPSILON 1e-9
+#define MARGEM_GRADE 0.25
+
+static int garantirCapacidade(Instancia *instancia, int capacidade);
+static void atualizarAGMInsercao(Instancia *instancia, int id);
+static void atualizarAGMRemocao(Instancia *instancia, int id);
+static int procurarCidadeAbsorvida(Instancia *instancia, int origem, int componente[], int absorvidos[], double *limite, int *destino);
+static int construirGrade(Instancia *instancia, double margem);
+static int inserirNaGrade(Instancia *instancia, int id);
+static void retirarDaGrade(Instancia *instancia, int id);
+static void ligarNaGrade(Instancia *instancia, int id);
+static int indiceEixo(double valor, double inicio, double lado, int quantidade);
+static void repararDoisOpt(Instancia *instancia, int arestas[], int quantidade);
+static void inverterTrecho(int ciclo[], int tam, int inicio, int comprimento);
+static void conferirInstancia(Instancia *instancia);
+
+/*Função que cria uma instância resolvida a partir de um vetor de pontos. Resolve a instância completa com resolverTSP() uma única vez e
+guarda a AGM e o ciclo para que inserções e remoções posteriores sejam feitas localmente. Os pontos são copiados, então o vetor de
+entrada pode ser liberado pelo chamador. Retorna NULL caso falte memória.*/
+Instancia *criarInstancia(Ponto pontos[], int tam){
+
+    Instancia *instancia;
+    EspacoTrabalho *espaco;
+
+    instancia = (Instancia *) calloc (1, sizeof(Instancia));
+
+    if(instancia == NULL)
+        return NULL;
+
+    instancia->agm = criarGrafo(0);
+
+    if(!garantirCapacidade(instancia, (tam > 0) ? tam : 1)){
+
+        destruirInstancia(instancia);
+        return NULL;
+
+    }
+
+    memcpy(instancia->pontos, pontos, tam * sizeof (Ponto));
+    memset(instancia->ativos, 1, tam);
+    instancia->tam = tam;
+    instancia->total = tam;
+
+    if(!construirGrade(instancia, 0)){
+
+        destruirInstancia(instancia);
+        return NULL;
+
+    }
+
+    if(tam > 0){
+
+        espaco = criarEspacoTrabalho(tam);
+
+        if(espaco == NULL){
+
+            destruirInstancia(instancia);
+            return NULL;
+
+        }
+
+        resolverTSP(instancia->pontos, tam, instancia->ciclo, &instancia->custo, espaco);
+
+        for(int i = 0; i < tam; i++){
+
+            if(espaco->prodecessores[i] >= 0){
+
+                adicionarAresta(espaco->prodecessores[i], i, espaco->custos[i], instancia->agm);
+                adicionarAresta(i, espaco->prodecessores[i], espaco->custos[i], instancia->agm);
+
+            }
+
+        }
+
+        destruirEspacoTrabalho(espaco);
+
+    }
+
+    instancia->agm->vertices = instancia->total;
+
+    return instancia;
+
+}
+
+/*Função que libera uma instância e todas as suas estruturas da memória.*/
+void destruirInstancia(Instancia *instancia){
+
+    if(instancia == NULL)
+        return;
+
+    if(instancia->agm != NULL){
+
+        instancia->agm->vertices = instancia->total;
+        destruirGrafo(instancia->agm);
+
+    }
+
+    free(instancia->pontos);
+    free(instancia->ativos);
+    free(instancia->ciclo);
+    free(instancia->rascunho);
+    free(instancia->rascunhoPesos);
+    free(instancia->grade.celulas);
+    free(instancia->grade.proximos);
+    free(instancia->grade.anteriores);
+    free(instancia);
+
+}
+
+/*Função que insere uma nova cidade em uma instância já resolvida. A AGM é atualizada de forma exata em O(n) por atualizarAGMInsercao() e a
+cidade é colocada no ciclo pela inserção mais barata, seguida de um reparo 2-opt restrito às posições próximas das arestas tocadas.
+Atualiza instancia->ciclo e instancia->custo e retorna o identificador da nova cidade (ou -1 caso falte memória).*/
+int adicionarCidade(Instancia *instancia, Ponto ponto){
+
+    int id = instancia->total, melhor = 0;
+    double melhorDelta;
+
+    if(!garantirCapacidade(instancia, instancia->total + 1))
+        return -1;
+
+    instancia->pontos[id] = ponto;
+    instancia->ativos[id] = 1;
+    instancia->total++;
+    instancia->agm->vertices = instancia->total;
+    instancia->agm->adjacencias[id] = NULL;
+
+    if(!inserirNaGrade(instancia, id)){
+
+        instancia->ativos[id] = 0;
+        instancia->agm->vertices = --instancia->total;
+
+        return -1;
+
+    }
+
+    atualizarAGMInsercao(instancia, id);
+
+    if(instancia->tam == 0){
+
+        instancia->ciclo[0] = id;
+        instancia->ciclo[1] = id;
+        instancia->tam = 1;
+        instancia->custo = 0;
+
+        return id;
+
+    }
+
+    //Inserção mais barata: escolhe a aresta (ciclo[i], ciclo[i + 1]) que menos aumenta o custo ao ser substituída por dois lados.
+    melhorDelta = -1;
+
+    for(int i = 0; i < instancia->tam; i++){
+
+        Ponto a = instancia->pontos[instancia->ciclo[i]];
+        Ponto b = instancia->pontos[instancia->ciclo[i + 1]];
+        double delta = calcularDistanciaPontos(a, ponto) + calcularDistanciaPontos(ponto, b) - calcularDistanciaPontos(a, b);
+
+        if(melhorDelta < 0 || delta < melhorDelta){
+
+            melhorDelta = delta;
+            melhor = i;
+
+        }
+
+    }
+
+    memmove(&instancia->ciclo[melhor + 2], &instancia->ciclo[melhor + 1], (instancia->tam - melhor) * sizeof (int));
+    instancia->ciclo[melhor + 1] = id;
+    instancia->tam++;
+    instancia->custo += melhorDelta;
+
+    int tocadas[2] = {melhor, melhor + 1};
+    repararDoisOpt(instancia, tocadas, 2);
+    conferirInstancia(instancia);
+
+    return id;
+
+}
+
+/*Função que remove uma cidade de uma instância já resolvida. A cidade sai do ciclo ligando diretamente seu antecessor ao seu sucessor,
+seguido de um reparo 2-opt em torno da nova aresta, e a AGM é religada de forma exata por atualizarAGMRemocao(), que usa a grade de
+células para achar as cidades mais próximas entre os componentes. Custa O(n) mais O(c * s) consultas à grade, onde c é o grau da cidade
+na AGM (no máximo 6 para pontos em posição geral) e s é o número de cidades fora do maior componente; com cidades bem distribuídas cada
+consulta examina poucas células, mas no pior caso (muitas cidades concentradas em poucas células) cada uma examina O(n) cidades e a
+remoção custa O(c * s * n). Atualiza instancia->ciclo e instancia->custo e retorna 1 em caso de sucesso ou 0 caso o identificador não
+seja de uma cidade ativa.*/
+int removerCidade(Instancia *instancia, int id){
+
+    int posicao = -1, tam = instancia->tam;
+
+    if(id < 0 || id >= instancia->total || !instancia->ativos[id])
+        return 0;
+
+    for(int i = 0; i < tam && posicao < 0; i++)
+        if(instancia->ciclo[i] == id)
+            posicao = i;
+
+    retirarDaGrade(instancia, id);
+    atualizarAGMRemocao(instancia, id);
+    instancia->ativos[id] = 0;
+
+    if(4 * (tam - 1) < instancia->grade.construida)
+        construirGrade(instancia, 0);
+
+    if(tam == 1){
+
+        instancia->tam = 0;
+        instancia->custo = 0;
+
+        return 1;
+
+    }
+
+    int anterior = instancia->ciclo[(posicao - 1 + tam) % tam];
+    int proximo = instancia->ciclo[(posicao + 1) % tam];
+
+    instancia->custo += calcularDistanciaPontos(instancia->pontos[anterior], instancia->pontos[proximo])
+                      - calcularDistanciaPontos(instancia->pontos[anterior], instancia->pontos[id])
+                      - calcularDistanciaPontos(instancia->pontos[id], instancia->pontos[proximo]);
+
+    memmove(&instancia->ciclo[posicao], &instancia->ciclo[posicao + 1], (tam - posicao - 1) * sizeof (int));
+    instancia->tam = --tam;
+    instancia->ciclo[tam] = instancia->ciclo[0];
+
+    int tocada = (posicao - 1 + tam) % tam;
+    repararDoisOpt(instancia, &tocada, 1);
+    conferirInstancia(instancia);
+
+    return 1;
+
+}
+
+/*Função que garante que os vetores da instância (e a lista de adjacências da AGM) comportem pelo menos a capacidade pedida. A capacidade
+é dobrada a cada crescimento para que inserções sucessivas tenham custo amortizado constante. Retorna 1 em caso de sucesso e 0 caso falte
+memória.*/
+static int garantirCapacidade(Instancia *instancia, int capacidade){
+
+    int nova = (instancia->capacidade > 0) ? instancia->capacidade : CAPACIDADE_MINIMA;
+
+    if(capacidade <= instancia->capacidade)
+        return 1;
+
+    while(nova < capacidade)
+        nova *= 2;
+
+    Ponto *pontos = (Ponto *) realloc (instancia->pontos, nova * sizeof (Ponto));
+    if(pontos == NULL)
+        return 0;
+    instancia->pontos = pontos;
+
+    char *ativos = (char *) realloc (instancia->ativos, nova * sizeof (char));
+    if(ativos == NULL)
+        return 0;
+    instancia->ativos = ativos;
+
+    int *ciclo = (int *) realloc (instancia->ciclo, (nova + 1) * sizeof (int));
+    if(ciclo == NULL)
+        return 0;
+    instancia->ciclo = ciclo;
+
+    int *rascunho = (int *) realloc (instancia->rascunho, 4 * nova * sizeof (int));
+    if(rascunho == NULL)
+        return 0;
+    instancia->rascunho = rascunho;
+
+    double *rascunhoPesos = (double *) realloc (instancia->rascunhoPesos, 2 * nova * sizeof (double));
+    if(rascunhoPesos == NULL)
+        return 0;
+    instancia->rascunhoPesos = rascunhoPesos;
+
+    int *proximos = (int *) realloc (instancia->grade.proximos, nova * sizeof (int));
+    if(proximos == NULL)
+        return 0;
+    instancia->grade.proximos = proximos;
+
+    int *anteriores = (int *) realloc (instancia->grade.anteriores, nova * sizeof (int));
+    if(anteriores == NULL)
+        return 0;
+    instancia->grade.anteriores = anteriores;
+
+    No **adjacencias = (No **) realloc (instancia->agm->adjacencias, nova * sizeof (No *));
+    if(adjacencias == NULL)
+        return 0;
+    instancia->agm->adjacencias = adjacencias;
+
+    for(int i = instancia->capacidade; i < nova; i++){
+
+        instancia->ativos[i] = 0;
+        instancia->agm->adjacencias[i] = NULL;
+
+    }
+
+    instancia->capacidade = nova;
+
+    return 1;
+
+}
+
+/*Função que atualiza a AGM após a inserção de uma cidade em O(n), sem ordenar arestas. A nova AGM está contida na AGM anterior somada
+às arestas da nova cidade (estrelas). A AGM anterior é enraizada e percorrida de baixo para cima: em cada vértice u começa-se com a estrela
+(id, u) e cada filho w é religado pela aresta (u, w), o que fecha um ciclo com o caminho até id pelos dois lados. A aresta mais pesada
+desse ciclo é descartada, e para cada vértice guarda-se a aresta mais pesada do seu caminho até id. As arestas são codificadas como 2 * u
+(estrela de u) e 2 * u + 1 (aresta entre u e seu pai).*/
+static void atualizarAGMInsercao(Instancia *instancia, int id){
+
+    Grafo *agm = instancia->agm;
+    int capacidade = instancia->capacidade, quantidade = 0, topo = 0, raiz = -1;
+    int *pais = instancia->rascunho, *ordem = pais + capacidade, *maiores = ordem + capacidade, *removidas = maiores + capacidade;
+    double *pesosPai = instancia->rascunhoPesos, *pesosEstrela = pesosPai + capacidade;
+
+    for(int i = 0; i < instancia->total && raiz < 0; i++)
+        if(instancia->ativos[i] && i != id)
+            raiz = i;
+
+    if(raiz < 0)
+        return;
+
+    //Ordem de pré-ordem da AGM anterior (o vetor maiores serve de pilha até ser preenchido).
+    pais[raiz] = -1;
+    maiores[topo++] = raiz;
+
+    while(topo > 0){
+
+        int u = maiores[--topo];
+
+        ordem[quantidade++] = u;
+        removidas[u] = 0;
+        pesosEstrela[u] = calcularDistanciaPontos(instancia->pontos[id], instancia->pontos[u]);
+
+        for(No *aux = agm->adjacencias[u]; aux != NULL; aux = aux->proximo){
+
+            if(aux->id != pais[u]){
+
+                pais[aux->id] = u;
+                pesosPai[aux->id] = aux->peso;
+                maiores[topo++] = aux->id;
+
+            }
+
+        }
+
+    }
+
+    for(int k = quantidade - 1; k >= 0; k--){
+
+        int u = ordem[k], caminho = 2 * u;
+
+        for(No *aux = agm->adjacencias[u]; aux != NULL; aux = aux->proximo){
+
+            if(aux->id == pais[u])
+                continue;
+
+            int aresta = 2 * aux->id + 1, filho = maiores[aux->id];
+            double pesoCaminho = (caminho & 1) ? pesosPai[caminho >> 1] : pesosEstrela[caminho >> 1];
+            double pesoFilho = (filho & 1) ? pesosPai[filho >> 1] : pesosEstrela[filho >> 1];
+            double pesoAresta = pesosPai[aux->id];
+
+            if(pesoAresta >= pesoCaminho && pesoAresta >= pesoFilho)
+                removidas[aux->id] |= 2;
+
+            else if(pesoFilho >= pesoCaminho)
+                removidas[filho >> 1] |= (filho & 1) ? 2 : 1;
+
+            else {
+
+                removidas[caminho >> 1] |= (caminho & 1) ? 2 : 1;
+                caminho = (pesoAresta > pesoFilho) ? aresta : filho;
+
+            }
+
+        }
+
+        maiores[u] = caminho;
+
+    }
+
+    for(int k = 0; k < quantidade; k++){
+
+        int u = ordem[k];
+
+        if(removidas[u] & 2){
+
+            removerAresta(pais[u], u, agm);
+            removerAresta(u, pais[u], agm);
+
+        }
+
+        if(!(removidas[u] & 1)){
+
+            adicionarAresta(id, u, pesosEstrela[u], agm);
+            adicionarAresta(u, id, pesosEstrela[u], agm);
+
+        }
+
+    }
+
+}
+
+/*Função que atualiza a AGM após a remoção de uma cidade de forma exata. As arestas que sobram da AGM anterior continuam em uma AGM sem a
+cidade (cada uma ainda é a mais leve do seu corte), então basta religar os componentes que ficam soltos (um por vizinho). O maior
+componente serve de raíz e os demais são absorvidos um a um, como num PRIM sobre componentes: a cada passo, cada cidade ainda solta
+procura na grade a cidade absorvida mais próxima, examinando só as células a menos da melhor distância já encontrada. O limite inicial é
+a aresta entre os vizinhos da cidade removida mais próximos dela (um absorvido e outro não), que pela desigualdade triangular é curta.
+Com c componentes e s cidades fora do maior, o custo é O(n) para rotular os componentes mais O(c * s) consultas à grade; no pior caso
+(cidades concentradas em poucas células) cada consulta examina O(n) cidades.*/
+static void atualizarAGMRemocao(Instancia *instancia, int id){
+
+    Grafo *agm = instancia->agm;
+    int capacidade = instancia->capacidade, componentes = 0, maior = 0, tamanhoMaior = 0, fim = 0;
+    int *componente = instancia->rascunho, *lista = componente + capacidade, *inicio = lista + capacidade, *absorvidos = inicio + capacidade;
+
+    for(int i = 0; i < instancia->total; i++)
+        componente[i] = -1;
+
+    componente[id] = -2;
+
+    //Cada vizinho da cidade removida inicia um componente, rotulado por uma busca em largura (a lista guarda os componentes em sequência).
+    while(agm->adjacencias[id] != NULL){
+
+        int vizinho = agm->adjacencias[id]->id;
+
+        removerAresta(vizinho, id, agm);
+        removerAresta(id, vizinho, agm);
+
+        inicio[componentes] = fim;
+        componente[vizinho] = componentes;
+        lista[fim++] = vizinho;
+
+        for(int k = inicio[componentes]; k < fim; k++)
+            for(No *aux = agm->adjacencias[lista[k]]; aux != NULL; aux = aux->proximo)
+                if(componente[aux->id] == -1){
+
+                    componente[aux->id] = componentes;
+                    lista[fim++] = aux->id;
+
+                }
+
+        if(fim - inicio[componentes] > tamanhoMaior){
+
+            tamanhoMaior = fim - inicio[componentes];
+            maior = componentes;
+
+        }
+
+        componentes++;
+
+    }
+
+    inicio[componentes] = fim;
+
+    for(int c = 0; c < componentes; c++)
+        absorvidos[c] = (c == maior);
+
+    for(int restantes = componentes - 1; restantes > 0; restantes--){
+
+        int origem = -1, destino = -1;
+        double distanciaOrigem = DBL_MAX, distanciaDestino = DBL_MAX, limite;
+
+        for(int c = 0; c < componentes; c++){
+
+            int vizinho = lista[inicio[c]];
+            double distancia = calcularDistanciaPontos(instancia->pontos[vizinho], instancia->pontos[id]);
+
+            if(absorvidos[c] && distancia < distanciaDestino){
+
+                distanciaDestino = distancia;
+                destino = vizinho;
+
+            }
+
+            else if(!absorvidos[c] && distancia < distanciaOrigem){
+
+                distanciaOrigem = distancia;
+                origem = vizinho;
+
+            }
+
+        }
+
+        limite = calcularDistanciaPontos(instancia->pontos[origem], instancia->pontos[destino]);
+
+        for(int c = 0; c < componentes; c++)
+            if(!absorvidos[c])
+                for(int k = inicio[c]; k < inicio[c + 1]; k++)
+                    if(procurarCidadeAbsorvida(instancia, lista[k], componente, absorvidos, &limite, &destino))
+                        origem = lista[k];
+
+        adicionarAresta(origem, destino, limite, agm);
+        adicionarAresta(destino, origem, limite, agm);
+        absorvidos[componente[origem]] = 1;
+
+    }
+
+}
+
+/*Função que procura, na grade, a cidade de um componente já absorvido mais próxima da cidade origem, desde que esteja a menos de *limite.
+Só são examinadas as células que cruzam o quadrado de lado 2 * *limite centrado na origem. Caso encontre, atualiza *limite e *destino e
+retorna 1; caso contrário, retorna 0.*/
+static int procurarCidadeAbsorvida(Instancia *instancia, int origem, int componente[], int absorvidos[], double *limite, int *destino){
+
+    Grade *grade = &instancia->grade;
+    Ponto ponto = instancia->pontos[origem];
+    int encontrou = 0;
+    int x0 = indiceEixo(ponto.x - *limite, grade->x, grade->lado, grade->colunas);
+    int x1 = indiceEixo(ponto.x + *limite, grade->x, grade->lado, grade->colunas);
+    int y0 = indiceEixo(ponto.y - *limite, grade->y, grade->lado, grade->linhas);
+    int y1 = indiceEixo(ponto.y + *limite, grade->y, grade->lado, grade->linhas);
+
+    for(int cy = y0; cy <= y1; cy++){
+
+        for(int cx = x0; cx <= x1; cx++){
+
+            for(int cidade = grade->celulas[cy * grade->colunas + cx]; cidade >= 0; cidade = grade->proximos[cidade]){
+
+                if(!absorvidos[componente[cidade]])
+                    continue;
+
+                double distancia = calcularDistanciaPontos(ponto, instancia->pontos[cidade]);
+
+                if(distancia < *limite){
+
+                    *limite = distancia;
+                    *destino = cidade;
+                    encontrou = 1;
+
+                }
+
+            }
+
+        }
+
+    }
+
+    return encontrou;
+
+}
+
+/*Função que (re)constrói a grade com todas as cidades ativas. A grade cobre o retângulo envolvente das cidades, ampliado de margem vezes a
+largura e a altura de cada lado, e tem cerca de uma célula por cidade (no máximo 3 * n + 1 células, mesmo com cidades alinhadas). Só
+aloca quando o número de células cresce, então reconstruir uma grade menor nunca falha. Retorna 1 em caso de sucesso e 0 caso falte
+memória (a grade anterior fica intacta).*/
+static int construirGrade(Instancia *instancia, double margem){
+
+    Grade *grade = &instancia->grade;
+    double xMinimo = DBL_MAX, xMaximo = -DBL_MAX, yMinimo = DBL_MAX, yMaximo = -DBL_MAX, largura, altura, lado;
+    int ativas = 0, colunas, linhas;
+
+    for(int i = 0; i < instancia->total; i++){
+
+        if(instancia->ativos[i]){
+
+            xMinimo = fmin(xMinimo, instancia->pontos[i].x);
+            xMaximo = fmax(xMaximo, instancia->pontos[i].x);
+            yMinimo = fmin(yMinimo, instancia->pontos[i].y);
+            yMaximo = fmax(yMaximo, instancia->pontos[i].y);
+            ativas++;
+
+        }
+
+    }
+
+    if(ativas == 0)
+        xMinimo = xMaximo = yMinimo = yMaximo = 0;
+
+    largura = (xMaximo - xMinimo) * (1 + 2 * margem);
+    altura = (yMaximo - yMinimo) * (1 + 2 * margem);
+    xMinimo -= (xMaximo - xMinimo) * margem;
+    yMinimo -= (yMaximo - yMinimo) * margem;
+
+    //O segundo termo limita o número de células quando a área é quase nula (cidades alinhadas).
+    lado = fmax(sqrt(largura * altura / ((ativas > 0) ? ativas : 1)), fmax(largura, altura) / ((ativas > 0) ? ativas : 1));
+
+    if(!(lado > 0))
+        lado = 1;
+
+    colunas = (int) (largura / lado) + 1;
+    linhas = (int) (altura / lado) + 1;
+
+    if(colunas * linhas > grade->capacidadeCelulas){
+
+        int *celulas = (int *) realloc (grade->celulas, colunas * linhas * sizeof (int));
+
+        if(celulas == NULL)
+            return 0;
+
+        grade->celulas = celulas;
+        grade->capacidadeCelulas = colunas * linhas;
+
+    }
+
+    grade->x = xMinimo;
+    grade->y = yMinimo;
+    grade->lado = lado;
+    grade->colunas = colunas;
+    grade->linhas = linhas;
+    grade->construida = ativas;
+
+    for(int i = 0; i < colunas * linhas; i++)
+        grade->celulas[i] = -1;
+
+    for(int i = 0; i < instancia->total; i++)
+        if(instancia->ativos[i])
+            ligarNaGrade(instancia, i);
+
+    return 1;
+
+}
+
+/*Função que coloca uma cidade nova na grade. A grade é reconstruída (com margem, para que cidades vizinhas não provoquem outra
+reconstrução logo em seguida) quando a cidade cai fora dela ou quando o número de cidades ativas dobrou desde a última construção, então o
+custo amortizado é constante. Retorna 1 em caso de sucesso e 0 caso falte memória.*/
+static int inserirNaGrade(Instancia *instancia, int id){
+
+    Grade *grade = &instancia->grade;
+    Ponto ponto = instancia->pontos[id];
+
+    if(ponto.x < grade->x || ponto.x >= grade->x + grade->colunas * grade->lado || ponto.y < grade->y ||
+       ponto.y >= grade->y + grade->linhas * grade->lado)
+        return construirGrade(instancia, MARGEM_GRADE);
+
+    if(instancia->tam >= 2 * grade->construida)
+        return construirGrade(instancia, 0);
+
+    ligarNaGrade(instancia, id);
+
+    return 1;
+
+}
+
+/*Função que tira uma cidade da lista da sua célula. Quando as cidades ativas caem para menos de um quarto das que havia na última
+construção, a grade é reconstruída menor (o que não aloca memória).*/
+static void retirarDaGrade(Instancia *instancia, int id){
+
+    Grade *grade = &instancia->grade;
+    Ponto ponto = instancia->pontos[id];
+    int celula = indiceEixo(ponto.y, grade->y, grade->lado, grade->linhas) * grade->colunas + indiceEixo(ponto.x, grade->x, grade->lado, grade->colunas);
+
+    if(grade->anteriores[id] >= 0)
+        grade->proximos[grade->anteriores[id]] = grade->proximos[id];
+
+    else
+        grade->celulas[celula] = grade->proximos[id];
+
+    if(grade->proximos[id] >= 0)
+        grade->anteriores[grade->proximos[id]] = grade->anteriores[id];
+
+}
+
+/*Função que coloca uma cidade no início da lista da sua célula.*/
+static void ligarNaGrade(Instancia *instancia, int id){
+
+    Grade *grade = &instancia->grade;
+    Ponto ponto = instancia->pontos[id];
+    int celula = indiceEixo(ponto.y, grade->y, grade->lado, grade->linhas) * grade->colunas + indiceEixo(ponto.x, grade->x, grade->lado, grade->colunas);
+
+    grade->proximos[id] = grade->celulas[celula];
+    grade->anteriores[id] = -1;
+
+    if(grade->celulas[celula] >= 0)
+        grade->anteriores[grade->celulas[celula]] = id;
+
+    grade->celulas[celula] = id;
+
+}
+
+/*Função que retorna o índice da célula que contém a coordenada valor em um eixo da grade, limitado a [0, quantidade). Por ser monótona,
+as células entre os índices de valor - r e valor + r cobrem todas as cidades a menos de r de valor nesse eixo.*/
+static int indiceEixo(double valor, double inicio, double lado, int quantidade){
+
+    double indice = floor((valor - inicio) / lado);
+
+    if(!(indice >= 0))
+        return 0;
+
+    if(indice >= quantidade)
+        return quantidade - 1;
+
+    return (int) indice;
+
+}
+
+/*Função que confere, em builds de depuração, se o ciclo da instância é uma permutação das cidades ativas e se o custo mantido de forma
+incremental coincide com o custo recalculado do zero.*/
+static void conferirInstancia(Instancia *instancia){
+
+#ifndef NDEBUG
+    char *marcas = (char *) malloc (instancia->total * sizeof (char));
+    double custo = calcularCustoCiclo(instancia->pontos, instancia->ciclo, instancia->tam);
+
+    assert(instancia->tam == 0 || validarCiclo(instancia->ciclo, instancia->tam, instancia->total, marcas));
+    assert(fabs(custo - instancia->custo) <= 1e-6 * (1 + custo));
+
+    for(int i = 0; i < instancia->tam; i++)
+        assert(instancia->ativos[instancia->ciclo[i]]);
+
+    free(marcas);
+#else
+    (void) instancia;
+#endif
+
+}
+
+/*Função que faz um reparo 2-opt local. Possui como entrada as posições das arestas do ciclo que foram tocadas pela última alteração
+(a aresta de posição i liga ciclo[i] a ciclo[i + 1]). Cada aresta tocada só é comparada com as arestas a até JANELA_LOCAL posições de
+distância no ciclo; quando a melhor troca melhora o custo, o menor dos dois trechos entre as arestas é invertido e as duas novas arestas
+passam a ser verificadas também. Com o número de trocas limitado, o reparo não depende do tamanho do ciclo.*/
+static void repararDoisOpt(Instancia *instancia, int arestas[], int quantidade){
+
+    int pendentes[MAXIMO_TROCAS_LOCAIS + 2], tam = instancia->tam, trocas = 0;
+    int alcance = (tam - 2 < JANELA_LOCAL) ? tam - 2 : JANELA_LOCAL;
+
+    if(tam < 4)
+        return;
+
+    for(int i = 0; i < quantidade; i++)
+        pendentes[i] = arestas[i];
+
+    while(quantidade > 0 && trocas < MAXIMO_TROCAS_LOCAIS){
+
+        int i = pendentes[--quantidade], melhor = -1;
+        double melhorDelta = -EPSILON;
+
+        //Com ciclos pequenos, as posições à frente já cobrem todas as arestas; caso contrário, olha também para trás.
+        for(int distancia = 2; distancia <= alcance; distancia++){
+
+            for(int sentido = 0; sentido < ((tam - 2 > JANELA_LOCAL) ? 2 : 1); sentido++){
+
+                int j = sentido ? (i - distancia + tam) % tam : (i + distancia) % tam;
+                double delta = deltaDoisOpt(instancia->pontos, instancia->ciclo, tam, i, j);
+
+                if(delta < melhorDelta){
+
+                    melhorDelta = delta;
+                    melhor = j;
+
+                }
+
+            }
+
+        }
+
+        if(melhor < 0)
+            continue;
+
+        //Inverter ciclo[i + 1..melhor] ou o complemento ciclo[melhor + 1..i] gera o mesmo ciclo; inverte o menor.
+        int comprimento = (melhor - i + tam) % tam;
+
+        if(comprimento <= tam - comprimento)
+            inverterTrecho(instancia->ciclo, tam, (i + 1) % tam, comprimento);
+
+        else
+            inverterTrecho(instancia->ciclo, tam, (melhor + 1) % tam, tam - comprimento);
+
+        instancia->custo += melhorDelta;
+        pendentes[quantidade++] = i;
+        pendentes[quantidade++] = melhor;
+        trocas++;
+
+    }
+
+}
+
+/*Função que inverte o trecho circular do ciclo com comprimento posições a partir de inicio e mantém a última posição (tam) igual à
+primeira.*/
+static void inverterTrecho(int ciclo[], int tam, int inicio, int comprimento){
+
+    for(int k = 0; k < comprimento / 2; k++){
+
+        int a = (inicio + k) % tam, b = (inicio + comprimento - 1 - k) % tam;
+        int aux = ciclo[a];
+
+        ciclo[a] = ciclo[b];
+        ciclo[b] = aux;
+
+    }
+
+    ciclo[tam] = ciclo[0];
+
+}
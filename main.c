@@ -0,0 +1,200 @@
+/*
+    Disciplina: Projeto e Análise de Algoritmos
+    Turma: S73
+    UTFPR - Curitiba
+
+    Alunos: 
+        Diego Henrique Arenas Okawa - 2127890
+        Louis Brommelstroet - 2127997
+        Ellejeane Camila Marques Ferreira dos Santos - 1904965
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <limits.h>
+#include <time.h>
+
+#include "tsp.h"
+
+#define MAGICO_BINARIO "TSPBIN1"
+
+/*Funções do programa de linha de comando.*/
+
+void exportarAGM(EspacoTrabalho *espaco, Ponto pontos[], int tam);
+void exportarCiclo(int ciclo[], Ponto *pontos, int tam);
+void imprimirCustoTotal(clock_t inicio, double custo);
+void destruirEstruturas(int ciclo[], Ponto pontos[], EspacoTrabalho *espaco);
+Ponto *lerArquivo(char nomeArquivo[], int *tam);
+
+/*Programa para encontrar uma aproximação para o problema do Caixeiro Viajante.*/
+int main(int argc, char *argv[]){
+
+    char *nomeArquivo = (argc > 1) ? argv[1] : "input.txt";
+    int tam, *ciclo;
+    double custo;
+    clock_t inicio;
+    EspacoTrabalho *espaco;
+    Ponto *pontos;
+    
+    inicio = clock();
+    pontos = lerArquivo(nomeArquivo, &tam);
+    espaco = criarEspacoTrabalho(tam);
+    ciclo = (int *) malloc ((tam + 1) * sizeof (int));
+
+    if(espaco == NULL || ciclo == NULL || !resolverTSP(pontos, tam, ciclo, &custo, espaco)){
+
+        printf("ERRO AO RESOLVER A INSTANCIA.\n");
+        exit(1);
+
+    }
+
+    exportarAGM(espaco, pontos, tam);
+    exportarCiclo(ciclo, pontos, tam);
+    imprimirCustoTotal(inicio, custo);
+    destruirEstruturas(ciclo, pontos, espaco);
+
+    return 0;
+
+}
+
+/*Função que cria um vetor de pontos a partir de pontos dados como entrada em um arquivo .txt. Também aceita o formato binário gerado por
+"genpoints -b" (MAGICO_BINARIO, um int64_t com a quantidade de pontos e os pontos como pares de double), que é lido diretamente para o
+vetor. Retorna um vetor de pontos.*/
+Ponto *lerArquivo(char nomeArquivo[], int *tam){
+
+    FILE *arquivo;
+    Ponto *pontos;
+    char magico[8];
+    int64_t quantidade;
+
+    arquivo = fopen(nomeArquivo, "rb");
+
+    if(arquivo == NULL){
+
+        printf("ERRO AO ABRIR O ARQUIVO.\n");
+        getchar();
+        exit(1);
+
+    }
+
+    if(fread(magico, 1, sizeof (magico), arquivo) == sizeof (magico) && memcmp(magico, MAGICO_BINARIO, sizeof (magico)) == 0){
+
+        if(fread(&quantidade, sizeof (quantidade), 1, arquivo) != 1 || quantidade < 0 || quantidade >= INT_MAX){
+
+            printf("ERRO AO LER O ARQUIVO.\n");
+            exit(1);
+
+        }
+
+        *tam = (int) quantidade;
+        pontos = (Ponto*) malloc ((*tam) * sizeof (Ponto));
+
+        if(fread(pontos, sizeof (Ponto), *tam, arquivo) != (size_t) (*tam)){
+
+            printf("ERRO AO LER O ARQUIVO.\n");
+            exit(1);
+
+        }
+
+        fclose(arquivo);
+
+        return pontos;
+
+    }
+
+    rewind(arquivo);
+    fscanf(arquivo, "%d", tam);
+
+    pontos = (Ponto*) malloc ((*tam) * sizeof (Ponto));
+
+    for(int i = 0; i < (*tam); i++)
+        fscanf(arquivo, "%lf %lf", &pontos[i].x, &pontos[i].y);
+
+    fclose(arquivo);
+
+    return pontos;
+
+}
+
+/*Função que exporta os pontos pertencentes ao ciclo em um arquivo "cycle.txt".*/
+void exportarCiclo(int ciclo[], Ponto *pontos, int tam){
+
+    FILE *arquivo;
+
+    arquivo = fopen("cycle.txt", "w");
+
+    if(arquivo == NULL){
+
+        printf("ERRO AO ABRIR O ARQUIVO.\n");
+        getchar();
+        exit(1);
+
+    }
+
+    for(int i = 0; i <= tam; i++)
+        fprintf(arquivo, "%d %d\n", (int) pontos[ciclo[i]].x, (int) pontos[ciclo[i]].y);   
+
+    fclose(arquivo);
+ 
+}
+
+/*Função que exporta os pontos da AGM guardada no espaço de trabalho em um arquivo "tree.txt". Cada aresta é escrita nos dois sentidos
+e, para cada vértice, os vizinhos saem do maior para o menor índice de inserção (o pai entra na posição do próprio vértice), que é a mesma
+ordem das listas de adjacências montadas pelo prim().*/
+void exportarAGM(EspacoTrabalho *espaco, Ponto pontos[], int tam){
+
+    FILE *arquivo;
+
+    arquivo = fopen("tree.txt", "w");
+
+    if(arquivo == NULL){
+
+        printf("ERRO AO ABRIR O ARQUIVO.\n");
+        getchar();
+        exit(1);
+
+    }
+
+    for(int i = 0; i < tam; i++){
+
+        int pai = espaco->prodecessores[i];
+
+        for(int j = espaco->inicioFilhos[i + 1] - 1; j >= espaco->inicioFilhos[i] - 1; j--){
+
+            int filho = (j >= espaco->inicioFilhos[i]) ? espaco->filhos[j] : -1;
+
+            if(pai >= 0 && filho < i){
+
+                fprintf(arquivo, "%d %d\n%d %d\n", (int) pontos[i].x, (int) pontos[i].y, (int) pontos[pai].x, (int) pontos[pai].y);
+                pai = -1;
+
+            }
+
+            if(filho >= 0)
+                fprintf(arquivo, "%d %d\n%d %d\n", (int) pontos[i].x, (int) pontos[i].y, (int) pontos[filho].x, (int) pontos[filho].y);
+
+        }
+
+    }
+
+    fclose(arquivo);
+
+}
+
+/*Função que imprime o tempo de execução e o custo total do ciclo.*/
+void imprimirCustoTotal(clock_t inicio, double custo){
+
+    printf("%.6f %.6f\n", (clock() - inicio) / (double)CLOCKS_PER_SEC, custo);
+   
+}
+
+/*Função que libera as estruturas utilizadas pelo programa da memória.*/
+void destruirEstruturas(int ciclo[], Ponto pontos[], EspacoTrabalho *espaco){
+
+    free(ciclo);
+    free(pontos);
+    destruirEspacoTrabalho(espaco);
+
+}
@@ -0,0 +1,530 @@
+/*
+    Disciplina: Projeto e Análise de Algoritmos
+    Turma: S73
+    UTFPR - Curitiba
+
+    Alunos:
+        Diego Henrique Arenas Okawa - 2127890
+        Louis Brommelstroet - 2127997
+        Ellejeane Camila Marques Ferreira dos Santos - 1904965
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "tsp.h"
+#include "grafo.h"
+
+#define TOLERANCIA 1e-6
+#define MAXIMO_VERTICES 16
+
+int falhas = 0;
+
+/*Funções de teste.*/
+
+void verificar(int condicao, const char mensagem[], int passo);
+void conferirInstanciaCompleta(Instancia *instancia, int passo);
+void testarSequenciaAleatoria(int tam, int operacoes, unsigned semente, Ponto (*sortear)(void));
+void testarEsvaziarERepovoar(void);
+void testarResolverTSP(int repeticoes);
+void testarReusoEspaco(void);
+void conferirSolucao(Ponto pontos[], int tam, EspacoTrabalho *espaco, int passo);
+void testarMovimentos(int repeticoes);
+void testarValidarCiclo(void);
+void testarCustoCiclo(int tam);
+double custoReferencia(Ponto pontos[], int ciclo[], int tam);
+double pesoAGM(Grafo *agm);
+double pesoAGMNova(Instancia *instancia);
+int sortearAtiva(Instancia *instancia);
+Ponto sortearPonto(void);
+Ponto sortearPontoRepetido(void);
+Ponto sortearPontoAlinhado(void);
+Ponto sortearPontoEspalhado(void);
+
+/*Programa que testa a biblioteca: executado por "make test", retorna 0 se todos os testes passarem.*/
+int main(void){
+
+    testarSequenciaAleatoria(1, 300, 1, sortearPonto);
+    testarSequenciaAleatoria(50, 500, 2, sortearPonto);
+    testarSequenciaAleatoria(400, 400, 3, sortearPonto);
+    testarSequenciaAleatoria(30, 300, 7, sortearPontoRepetido);
+    testarSequenciaAleatoria(30, 300, 8, sortearPontoAlinhado);
+    testarSequenciaAleatoria(30, 300, 9, sortearPontoEspalhado);
+    testarEsvaziarERepovoar();
+    testarResolverTSP(200);
+    testarReusoEspaco();
+    testarMovimentos(20000);
+    testarValidarCiclo();
+    testarCustoCiclo(1000);
+    testarCustoCiclo(300000);
+
+    if(falhas > 0){
+
+        printf("%d FALHA(S).\n", falhas);
+        return 1;
+
+    }
+
+    printf("TODOS OS TESTES PASSARAM.\n");
+
+    return 0;
+
+}
+
+/*Função que registra uma falha caso a condição seja falsa.*/
+void verificar(int condicao, const char mensagem[], int passo){
+
+    if(!condicao){
+
+        printf("FALHA (passo %d): %s\n", passo, mensagem);
+        falhas++;
+
+    }
+
+}
+
+/*Função que retorna um ponto com coordenadas inteiras sorteadas em [0, 1024).*/
+Ponto sortearPonto(void){
+
+    Ponto ponto = {rand() % 1024, rand() % 1024};
+
+    return ponto;
+
+}
+
+/*Função que retorna um ponto sorteado entre poucas posições, para gerar muitas cidades coincidentes.*/
+Ponto sortearPontoRepetido(void){
+
+    Ponto ponto = {rand() % 3, rand() % 3};
+
+    return ponto;
+
+}
+
+/*Função que retorna um ponto sorteado sobre uma reta, para gerar instâncias de área nula.*/
+Ponto sortearPontoAlinhado(void){
+
+    double t = rand() % 1024;
+    Ponto ponto = {t, 2 * t + 1};
+
+    return ponto;
+
+}
+
+/*Função que retorna um ponto com coordenadas de ordens de grandeza bem diferentes, para que as inserções caiam fora da grade.*/
+Ponto sortearPontoEspalhado(void){
+
+    Ponto ponto = {(rand() % 2001 - 1000) * pow(10, rand() % 7), (rand() % 2001 - 1000) * pow(10, rand() % 7)};
+
+    return ponto;
+
+}
+
+/*Função que sorteia o identificador de uma cidade ativa (a instância não pode estar vazia).*/
+int sortearAtiva(Instancia *instancia){
+
+    int id;
+
+    do
+        id = rand() % instancia->total;
+    while(!instancia->ativos[id]);
+
+    return id;
+
+}
+
+/*Função que soma os pesos das arestas de uma AGM guardada como grafo (cada aresta aparece nos dois sentidos).*/
+double pesoAGM(Grafo *agm){
+
+    double peso = 0;
+
+    for(int i = 0; i < agm->vertices; i++)
+        for(No *aux = agm->adjacencias[i]; aux != NULL; aux = aux->proximo)
+            peso += aux->peso;
+
+    return peso / 2;
+
+}
+
+/*Função que calcula do zero o peso da AGM das cidades ativas de uma instância.*/
+double pesoAGMNova(Instancia *instancia){
+
+    Ponto *pontos = (Ponto *) malloc (instancia->tam * sizeof (Ponto));
+    EspacoTrabalho *espaco = criarEspacoTrabalho(instancia->tam);
+    double peso = 0;
+    int tam = 0;
+
+    for(int i = 0; i < instancia->total; i++)
+        if(instancia->ativos[i])
+            pontos[tam++] = instancia->pontos[i];
+
+    calcularAGM(pontos, tam, 0, espaco);
+
+    for(int i = 1; i < tam; i++)
+        peso += espaco->custos[i];
+
+    destruirEspacoTrabalho(espaco);
+    free(pontos);
+
+    return peso;
+
+}
+
+/*Função que confere todas as propriedades de uma instância: o ciclo é uma permutação das cidades ativas, o custo mantido coincide com o
+recalculado, e a AGM tem tam - 1 arestas e o mesmo peso de uma AGM calculada do zero.*/
+void conferirInstanciaCompleta(Instancia *instancia, int passo){
+
+    char *marcas = (char *) malloc (instancia->total + 1);
+    int ativas = 0;
+
+    for(int i = 0; i < instancia->total; i++)
+        ativas += instancia->ativos[i];
+
+    verificar(ativas == instancia->tam, "numero de cidades ativas", passo);
+    verificar(instancia->agm->arestas == 2 * ((instancia->tam > 0) ? instancia->tam - 1 : 0), "numero de arestas da AGM", passo);
+
+    if(instancia->tam > 0){
+
+        double custo = calcularCustoCiclo(instancia->pontos, instancia->ciclo, instancia->tam);
+        double peso = pesoAGMNova(instancia);
+
+        verificar(validarCiclo(instancia->ciclo, instancia->tam, instancia->total, marcas), "ciclo nao eh permutacao", passo);
+
+        for(int i = 0; i < instancia->tam; i++)
+            verificar(instancia->ativos[instancia->ciclo[i]], "cidade removida no ciclo", passo);
+
+        verificar(fabs(custo - instancia->custo) <= TOLERANCIA * (1 + custo), "custo incremental difere do recalculado", passo);
+        verificar(fabs(peso - pesoAGM(instancia->agm)) <= TOLERANCIA * (1 + peso), "AGM incremental difere da recalculada", passo);
+
+    }
+
+    free(marcas);
+
+}
+
+/*Função que aplica uma sequência aleatória de inserções e remoções, conferindo a instância após cada operação. Os pontos são gerados pela
+função sortear.*/
+void testarSequenciaAleatoria(int tam, int operacoes, unsigned semente, Ponto (*sortear)(void)){
+
+    Ponto *pontos = (Ponto *) malloc (tam * sizeof (Ponto));
+    Instancia *instancia;
+
+    srand(semente);
+
+    for(int i = 0; i < tam; i++)
+        pontos[i] = sortear();
+
+    instancia = criarInstancia(pontos, tam);
+    conferirInstanciaCompleta(instancia, 0);
+
+    for(int passo = 1; passo <= operacoes; passo++){
+
+        if(instancia->tam == 0 || rand() % 2)
+            verificar(adicionarCidade(instancia, sortear()) >= 0, "adicionarCidade falhou", passo);
+
+        else
+            verificar(removerCidade(instancia, sortearAtiva(instancia)), "removerCidade falhou", passo);
+
+        conferirInstanciaCompleta(instancia, passo);
+
+    }
+
+    destruirInstancia(instancia);
+    free(pontos);
+
+}
+
+/*Função que remove todas as cidades de uma instância, confere os identificadores inválidos e volta a inserir cidades.*/
+void testarEsvaziarERepovoar(void){
+
+    Ponto pontos[30];
+    Instancia *instancia;
+    int passo = 0;
+
+    srand(4);
+
+    for(int i = 0; i < 30; i++)
+        pontos[i] = sortearPonto();
+
+    instancia = criarInstancia(pontos, 30);
+
+    while(instancia->tam > 0){
+
+        verificar(removerCidade(instancia, sortearAtiva(instancia)), "removerCidade falhou", ++passo);
+        conferirInstanciaCompleta(instancia, passo);
+
+    }
+
+    verificar(instancia->custo == 0, "custo da instancia vazia", passo);
+    verificar(!removerCidade(instancia, 0), "remocao de cidade ja removida", passo);
+    verificar(!removerCidade(instancia, -1), "remocao de identificador negativo", passo);
+    verificar(!removerCidade(instancia, instancia->total), "remocao de identificador inexistente", passo);
+
+    for(int i = 0; i < 40; i++){
+
+        verificar(adicionarCidade(instancia, sortearPonto()) == 30 + i, "identificador da nova cidade", ++passo);
+        conferirInstanciaCompleta(instancia, passo);
+
+    }
+
+    destruirInstancia(instancia);
+
+    instancia = criarInstancia(pontos, 0);
+    conferirInstanciaCompleta(instancia, 0);
+
+    for(int i = 0; i < 10; i++){
+
+        adicionarCidade(instancia, pontos[i]);
+        conferirInstanciaCompleta(instancia, ++passo);
+
+    }
+
+    destruirInstancia(instancia);
+
+}
+
+/*Função que resolve uma instância com resolverTSP() e confere o resultado: o ciclo é uma permutação fechada, o custo devolvido coincide
+com o recalculado e a AGM guardada no espaço de trabalho tem o mesmo peso da AGM calculada por prim() sobre o grafo completo.*/
+void conferirSolucao(Ponto pontos[], int tam, EspacoTrabalho *espaco, int passo){
+
+    int *ciclo = (int *) malloc ((tam + 1) * sizeof (int));
+    char *marcas = (char *) malloc (tam);
+    double custo, peso = 0, pesoPrim;
+    Grafo *grafo, *agm;
+
+    verificar(resolverTSP(pontos, tam, ciclo, &custo, espaco), "resolverTSP falhou", passo);
+    verificar(validarCiclo(ciclo, tam, tam, marcas), "ciclo de resolverTSP nao eh permutacao", passo);
+    verificar(fabs(custo - calcularCustoCiclo(pontos, ciclo, tam)) <= TOLERANCIA * (1 + custo), "custo de resolverTSP difere do recalculado", passo);
+
+    for(int i = 0; i < tam; i++)
+        peso += espaco->custos[i];
+
+    grafo = preencherGrafo(pontos, tam);
+    agm = prim(grafo, 0, pontos);
+    pesoPrim = pesoAGM(agm);
+
+    verificar(fabs(peso - pesoPrim) <= TOLERANCIA * (1 + peso), "AGM de resolverTSP difere da de prim()", passo);
+
+    destruirGrafo(agm);
+    destruirGrafo(grafo);
+    free(marcas);
+    free(ciclo);
+
+}
+
+/*Função que confere resolverTSP() contra prim() em instâncias sorteadas de vários tamanhos, cada uma com seu espaço de trabalho.*/
+void testarResolverTSP(int repeticoes){
+
+    srand(10);
+
+    for(int passo = 1; passo <= repeticoes; passo++){
+
+        int tam = 1 + rand() % 200;
+        Ponto *pontos = (Ponto *) malloc (tam * sizeof (Ponto));
+        EspacoTrabalho *espaco = criarEspacoTrabalho(tam);
+
+        for(int i = 0; i < tam; i++)
+            pontos[i] = sortearPonto();
+
+        conferirSolucao(pontos, tam, espaco, passo);
+
+        destruirEspacoTrabalho(espaco);
+        free(pontos);
+
+    }
+
+}
+
+/*Função que reutiliza um único espaço de trabalho em chamadas de tamanhos diferentes, inclusive tam == capacidade, e confere que tam
+maior que a capacidade (ou nulo) é recusado sem atrapalhar as chamadas seguintes.*/
+void testarReusoEspaco(void){
+
+    int capacidade = 120, tamanhos[] = {120, 1, 57, 2, 120, 3, 119, 64};
+    Ponto pontos[121];
+    int ciclo[122];
+    double custo;
+    EspacoTrabalho *espaco = criarEspacoTrabalho(capacidade);
+
+    srand(11);
+
+    for(int passo = 0; passo < (int) (sizeof (tamanhos) / sizeof (tamanhos[0])); passo++){
+
+        for(int i = 0; i <= capacidade; i++)
+            pontos[i] = sortearPonto();
+
+        conferirSolucao(pontos, tamanhos[passo], espaco, passo);
+
+        verificar(!resolverTSP(pontos, capacidade + 1, ciclo, &custo, espaco), "resolverTSP aceitou tam > capacidade", passo);
+        verificar(!resolverTSP(pontos, 0, ciclo, &custo, espaco), "resolverTSP aceitou instancia vazia", passo);
+
+    }
+
+    destruirEspacoTrabalho(espaco);
+
+}
+
+/*Função que calcula o custo de um ciclo com tam posições da forma mais direta possível, para comparar com as funções da biblioteca.*/
+double custoReferencia(Ponto pontos[], int ciclo[], int tam){
+
+    double custo = 0;
+
+    for(int i = 0; i < tam; i++)
+        custo += calcularDistanciaPontos(pontos[ciclo[i]], pontos[ciclo[(i + 1) % tam]]);
+
+    return custo;
+
+}
+
+/*Função que confere deltaDoisOpt(), deltaOrOpt() e deltaTroca() em ciclos pequenos sorteados: cada movimento é aplicado a uma cópia
+do ciclo e a diferença entre os custos recalculados deve coincidir com o delta.*/
+void testarMovimentos(int repeticoes){
+
+    Ponto pontos[MAXIMO_VERTICES];
+    int ciclo[MAXIMO_VERTICES + 1], copia[MAXIMO_VERTICES + 1];
+
+    srand(5);
+
+    for(int passo = 1; passo <= repeticoes; passo++){
+
+        int tam = 4 + rand() % (MAXIMO_VERTICES - 3), i, j, comprimento, invertido;
+        double base;
+
+        for(int k = 0; k < tam; k++){
+
+            pontos[k] = sortearPonto();
+            ciclo[k] = k;
+
+        }
+
+        for(int k = tam - 1; k > 0; k--){
+
+            int sorteado = rand() % (k + 1), aux = ciclo[k];
+
+            ciclo[k] = ciclo[sorteado];
+            ciclo[sorteado] = aux;
+
+        }
+
+        ciclo[tam] = ciclo[0];
+        base = custoReferencia(pontos, ciclo, tam);
+
+        //2-opt: inverte o trecho circular de ciclo[i + 1] até ciclo[j]; j pode vir antes de i (o trecho dá a volta no ciclo).
+        i = rand() % tam;
+        j = (i + 2 + rand() % (tam - 3)) % tam;
+        comprimento = (j - i + tam) % tam;
+        memcpy(copia, ciclo, sizeof (ciclo));
+
+        for(int k = 0; k < comprimento / 2; k++){
+
+            int a = (i + 1 + k) % tam, b = (i + comprimento - k) % tam;
+            int aux = copia[a];
+
+            copia[a] = copia[b];
+            copia[b] = aux;
+
+        }
+
+        verificar(fabs(custoReferencia(pontos, copia, tam) - base - deltaDoisOpt(pontos, ciclo, tam, i, j)) <= TOLERANCIA, "deltaDoisOpt", passo);
+
+        //Troca: quaisquer duas posições, inclusive vizinhas e iguais.
+        i = rand() % tam;
+        j = rand() % tam;
+        memcpy(copia, ciclo, sizeof (ciclo));
+        copia[i] = ciclo[j];
+        copia[j] = ciclo[i];
+
+        verificar(fabs(custoReferencia(pontos, copia, tam) - base - deltaTroca(pontos, ciclo, tam, i, j)) <= TOLERANCIA, "deltaTroca", passo);
+
+        //Or-opt: o trecho [i, i + comprimento) é reinserido depois da posição j, que fica fora dele e não é a anterior a ele.
+        comprimento = 1 + rand() % ((tam - 2 < 3) ? tam - 2 : 3);
+        i = rand() % tam;
+        j = (i + comprimento + rand() % (tam - comprimento - 1)) % tam;
+        invertido = rand() % 2;
+
+        int m = 0;
+
+        for(int k = 0; k < tam - comprimento; k++){
+
+            int vertice = ciclo[(i + comprimento + k) % tam];
+
+            copia[m++] = vertice;
+
+            if(vertice == ciclo[j])
+                for(int q = 0; q < comprimento; q++)
+                    copia[m++] = ciclo[(i + (invertido ? comprimento - 1 - q : q)) % tam];
+
+        }
+
+        verificar(fabs(custoReferencia(pontos, copia, tam) - base - deltaOrOpt(pontos, ciclo, tam, i, comprimento, j, invertido)) <= TOLERANCIA,
+                  "deltaOrOpt", passo);
+
+    }
+
+}
+
+/*Função que confere validarCiclo() com um ciclo válido e com ciclos que repetem um vértice, usam um vértice fora do intervalo ou não
+são fechados.*/
+void testarValidarCiclo(void){
+
+    int ciclo[] = {3, 0, 4, 1, 2, 3};
+    char marcas[8];
+
+    verificar(validarCiclo(ciclo, 5, 5, marcas), "validarCiclo rejeitou ciclo valido", 0);
+    verificar(validarCiclo(ciclo, 5, 8, marcas), "validarCiclo rejeitou ciclo com vertices sobrando", 0);
+    verificar(!validarCiclo(ciclo, 5, 4, marcas), "validarCiclo aceitou vertice fora do intervalo", 0);
+    verificar(!validarCiclo(ciclo, 0, 5, marcas), "validarCiclo aceitou ciclo vazio", 0);
+
+    ciclo[5] = 2;
+    verificar(!validarCiclo(ciclo, 5, 5, marcas), "validarCiclo aceitou ciclo nao fechado", 0);
+
+    ciclo[5] = 3;
+    ciclo[2] = 0;
+    verificar(!validarCiclo(ciclo, 5, 5, marcas), "validarCiclo aceitou vertice repetido", 0);
+
+    ciclo[2] = -1;
+    verificar(!validarCiclo(ciclo, 5, 5, marcas), "validarCiclo aceitou vertice negativo", 0);
+
+}
+
+/*Função que confere calcularCustoCiclo() contra uma soma em long double e que o ciclo aberto (tam posições) e o fechado (tam + 1) dão o
+mesmo custo, mesmo com lixo na posição tam do fechado. Com tam acima de LIMIAR_PARALELO, confere também a versão paralela.*/
+void testarCustoCiclo(int tam){
+
+    Ponto *pontos = (Ponto *) malloc (tam * sizeof (Ponto));
+    int *ciclo = (int *) malloc ((tam + 1) * sizeof (int));
+    int *aberto = (int *) malloc (tam * sizeof (int));
+    long double referencia = 0;
+    double custo;
+
+    srand(6);
+
+    for(int i = 0; i < tam; i++){
+
+        pontos[i].x = rand() / 1e3;
+        pontos[i].y = rand() / 1e3;
+        ciclo[i] = i;
+
+    }
+
+    ciclo[tam] = 0;
+
+    for(int i = 0; i < tam; i++)
+        referencia += calcularDistanciaPontos(pontos[ciclo[i]], pontos[ciclo[i + 1]]);
+
+    custo = calcularCustoCiclo(pontos, ciclo, tam);
+
+    verificar(fabs((double) (custo - referencia)) <= 1e-12 * custo, "calcularCustoCiclo difere da soma de referencia", 0);
+
+    memcpy(aberto, ciclo, tam * sizeof (int));
+    verificar(custo == calcularCustoCiclo(pontos, aberto, tam), "ciclo aberto e fechado tem custos diferentes", 0);
+
+    ciclo[tam] = tam / 2;
+    verificar(custo == calcularCustoCiclo(pontos, ciclo, tam), "calcularCustoCiclo leu a posicao tam do ciclo", 0);
+
+    free(aberto);
+    free(ciclo);
+    free(pontos);
+
+}
@@ -10,29 +10,12 @@
 */
 
 #include <stdlib.h>
-#include <limits.h>
-#include <stdio.h>
 #include <float.h>
-#include <time.h>
 #include <math.h>
+#include <assert.h>
 
-/*Estrutura que define um nó do grafo.*/
-typedef struct no {
-
-    int id; //Número do vértice.
-    double peso; //Peso da aresta.
-    struct no *proximo; //Ponteiro para o próximo nó.
-    
-} No;
-
-/*Estrutura que representa o grafo.*/
-typedef struct grafo {
-
-    int arestas; //Número de arestas do grafo.
-    int vertices; //Número de vértices do grafo.
-    No **adjacencias; //Lista de adjacências do grafo.
-
-} Grafo;
+#include "tsp.h"
+#include "grafo.h"
 
 /*Estrutura que armazena um vértice e um determinado custo associado a ele (é usada na construção do HEAP mínimo).*/
 typedef struct verticeCusto {
@@ -51,103 +34,23 @@ typedef struct heapMinimo {
 
 } HeapMinimo;
 
-/*Estrutura que representa um ponto no plano cartesiano.*/
-typedef struct ponto {
-    
-    double x; //Valor correspondente ao eixo X.
-    double y; //Valor correspondente ao eixo Y.
-
-} Ponto;
-
-/*Funções para pontos.*/
-
-double calcularDistanciaPontos(Ponto p1, Ponto p2);
-
-/*Funções para grafos.*/
-
-int *buscaProfundidade(Grafo *agm, int vertice);
-void destruirGrafo(Grafo *grafo);
-void adicionarAresta(int v1, int v2, double peso, Grafo *grafo);
-void buscaProfundidadeAuxiliar(Grafo *agm, int vertice, int ciclo[], int *itr, int visitados[]);
-void exportarAGM(Grafo *agm, Ponto pontos[]);
-void exportarCiclo(int ciclo[], Ponto *pontos, int tam);
-void inicializarPrim(HeapMinimo *heapMinimo, double custos[], int prodecessores[], int tam);
-void marcarNaoVisitados(int visitados[], int tam);
-void imprimirCustoTotal(clock_t inicio, Ponto pontos[], int ciclo[], int tam);
-void destruirEstruturas(int ciclo[], Ponto pontos[], Grafo *grafo, Grafo *agm);
-double calcularCustoTotal(Ponto pontos[], int ciclo[], int tam);
-Ponto *lerArquivo(char nomeArquivo[], int *tam);
-Grafo *prim(Grafo *grafo, int vertice, Ponto pontos[]);
-Grafo *criarGrafo(int tamanho);
-Grafo *preencherGrafo(Ponto pontos[], int tam);
-
-/*Funções para HEAP mínimo.*/
-
-int pai(int i);
-int filhoEsquerda(int i);
-int filhoDireita(int i);
-int existe(HeapMinimo *heapMinimo, int vertice);
-int vazio(HeapMinimo *heapMinimo);
-void trocar(HeapMinimo *heapMinimo, int a, int b);
-void atualizarHeapMinimo(HeapMinimo *heapMinimo, int i);
-void construirHeapMinimo(HeapMinimo *heapMinimo);
-void diminuirValorChave(HeapMinimo *heapMinimo, int i, double chave);
-void destruirHeapMinimo(HeapMinimo *heapMinimo);
-VerticeCusto extrairMinimo(HeapMinimo *heapMinimo);
-HeapMinimo *criarHeapMinimo(int tam);
-
-/*Programa para encontrar uma aproximação para o problema do Caixeiro Viajante.*/
-int main(int argc, char *argv[]){
-
-    char *nomeArquivo = (argc > 1) ? argv[1] : "input.txt";
-    int tam, *ciclo;
-    clock_t inicio;
-    Grafo *grafo, *agm;
-    Ponto *pontos;
-    
-    inicio = clock();
-    pontos = lerArquivo(nomeArquivo, &tam);
-    grafo = preencherGrafo(pontos, tam);        //Passo 1. Computar um grafo completo dos pontos, sendo o custo a distância euclidiana.
-    agm = prim(grafo, 0, pontos);               //Passo 2. Computar a Árvore Geradora Mímina.
-    ciclo = buscaProfundidade(agm, 0);          //Passo 3. Computar o ciclo usando Busca em Profundidade.
-
-    exportarAGM(agm, pontos);
-    exportarCiclo(ciclo, pontos, tam);
-    imprimirCustoTotal(inicio, pontos, ciclo, agm->vertices);
-    destruirEstruturas(ciclo, pontos, grafo, agm);
-
-    return 0;
-
-}
-
-/*Função que cria um vetor de pontos a partir de pontos dados como entrada em um arquivo .txt. Retorna um vetor de pontos.*/
-Ponto *lerArquivo(char nomeArquivo[], int *tam){
-
-    FILE *arquivo;
-    Ponto *pontos;
-
-    arquivo = fopen(nomeArquivo, "r");
-
-    if(arquivo == NULL){
-
-        printf("ERRO AO ABRIR O ARQUIVO.\n");
-        getchar();
-        exit(1);
-
-    }
-
-    fscanf(arquivo, "%d", tam);
-
-    pontos = (Ponto*) malloc ((*tam) * sizeof (Ponto));
-
-    for(int i = 0; i < (*tam); i++)
-        fscanf(arquivo, "%lf %lf", &pontos[i].x, &pontos[i].y);
-
-    fclose(arquivo);
-
-    return pontos;
-
-}
+/*Funções internas para HEAP mínimo e busca em profundidade.*/
+
+static int pai(int i);
+static int filhoEsquerda(int i);
+static int filhoDireita(int i);
+static int existe(HeapMinimo *heapMinimo, int vertice);
+static int vazio(HeapMinimo *heapMinimo);
+static void trocar(HeapMinimo *heapMinimo, int a, int b);
+static void atualizarHeapMinimo(HeapMinimo *heapMinimo, int i);
+static void construirHeapMinimo(HeapMinimo *heapMinimo);
+static void diminuirValorChave(HeapMinimo *heapMinimo, int i, double chave);
+static void destruirHeapMinimo(HeapMinimo *heapMinimo);
+static void inicializarPrim(HeapMinimo *heapMinimo, double custos[], int prodecessores[], int tam);
+static void marcarNaoVisitados(int visitados[], int tam);
+static void buscaProfundidadeAuxiliar(Grafo *agm, int vertice, int ciclo[], int *itr, int visitados[]);
+static VerticeCusto extrairMinimo(HeapMinimo *heapMinimo);
+static HeapMinimo *criarHeapMinimo(int tam);
 
 /*Função para inicializar a estrutura de um grafo.*/
 Grafo *criarGrafo(int tamanho){
@@ -185,9 +88,19 @@ Grafo *preencherGrafo(Ponto pontos[], int tam){
 /*Função para liberar um grafo da memória.*/
 void destruirGrafo(Grafo *grafo){
 
-    for(int i = 0; i < grafo->vertices; i++)
-        for(No *aux = grafo->adjacencias[i]; aux != NULL; aux = aux->proximo)
+    for(int i = 0; i < grafo->vertices; i++){
+
+        No *aux = grafo->adjacencias[i];
+
+        while(aux != NULL){
+
+            No *proximo = aux->proximo;
             free(aux);
+            aux = proximo;
+
+        }
+
+    }
 
     free(grafo->adjacencias);
     free(grafo);
@@ -217,14 +130,37 @@ void adicionarAresta(int v1, int v2, double peso, Grafo *grafo){
 
 }
 
+/*Função para remover a aresta que vai de v1 até v2 em um grafo. Percorre a lista de adjacências de v1 até encontrar v2 e libera o nó
+correspondente. Retorna 1 caso a aresta tenha sido removida e 0 caso ela não exista.*/
+int removerAresta(int v1, int v2, Grafo *grafo){
+
+    for(No **aux = &grafo->adjacencias[v1]; *aux != NULL; aux = &(*aux)->proximo){
+
+        if((*aux)->id == v2){
+
+            No *removido = *aux;
+            *aux = removido->proximo;
+            free(removido);
+            grafo->arestas--;
+
+            return 1;
+
+        }
+
+    }
+
+    return 0;
+
+}
+
 /*Função que utiliza o algoritmo de Prim para computar uma árvore geradora mínima. Possui um grafo, um vértice raíz e um vetor de pontos
 como entrada. Retorna uma AGM do tipo Grafo *. Foram criados dois vetores, um de prodecessores e um de custos. Cada qual armazena uma
 informação sobre um determinado vértice (quem é seu pai (prodecessor) e qual o custo para chegar até ele a partir do procecessor. Com
 o resultado do vetor de prodecessores e custos, são adicionadas as arestas na Árvore Geradora Mínima e então ela é retornada.*/
 Grafo *prim(Grafo *grafo, int vertice, Ponto pontos[]){
 
-    int prodecessores[grafo->vertices];
-    double custos[grafo->vertices];
+    int *prodecessores = (int *) malloc (grafo->vertices * sizeof (int));
+    double *custos = (double *) malloc (grafo->vertices * sizeof (double));
     HeapMinimo *heapMinimo;
     Grafo *agm;
     
@@ -263,14 +199,182 @@ Grafo *prim(Grafo *grafo, int vertice, Ponto pontos[]){
     }
 
     destruirHeapMinimo(heapMinimo);
+    free(prodecessores);
+    free(custos);
 
     return agm;
 
 }
 
+/*Função que cria um espaço de trabalho capaz de resolver instâncias de até capacidade pontos. Todos os vetores auxiliares são alocados
+aqui, então resolverTSP() não faz nenhuma alocação. Retorna NULL caso falte memória.*/
+EspacoTrabalho *criarEspacoTrabalho(int capacidade){
+
+    EspacoTrabalho *espaco = (EspacoTrabalho *) malloc (sizeof(EspacoTrabalho));
+
+    if(espaco == NULL)
+        return NULL;
+
+    espaco->capacidade = capacidade;
+    espaco->prodecessores = (int *) malloc (capacidade * sizeof (int));
+    espaco->custos = (double *) malloc (capacidade * sizeof (double));
+    espaco->visitados = (char *) malloc (capacidade * sizeof (char));
+    espaco->inicioFilhos = (int *) malloc ((capacidade + 1) * sizeof (int));
+    espaco->filhos = (int *) malloc (capacidade * sizeof (int));
+    espaco->pilha = (int *) malloc (capacidade * sizeof (int));
+
+    if(capacidade > 0 && (espaco->prodecessores == NULL || espaco->custos == NULL || espaco->visitados == NULL ||
+       espaco->inicioFilhos == NULL || espaco->filhos == NULL || espaco->pilha == NULL)){
+
+        destruirEspacoTrabalho(espaco);
+        return NULL;
+
+    }
+
+    return espaco;
+
+}
+
+/*Função que libera um espaço de trabalho e todos os seus vetores da memória.*/
+void destruirEspacoTrabalho(EspacoTrabalho *espaco){
+
+    if(espaco == NULL)
+        return;
+
+    free(espaco->prodecessores);
+    free(espaco->custos);
+    free(espaco->visitados);
+    free(espaco->inicioFilhos);
+    free(espaco->filhos);
+    free(espaco->pilha);
+    free(espaco);
+
+}
+
+/*Função que resolve uma instância a partir de um vetor de pontos, sem montar o grafo completo. Computa a AGM com calcularAGM() a partir
+do vértice 0 e o ciclo com gerarCiclo(), que deve ter espaço para tam + 1 vértices. O custo total do ciclo é devolvido por referência.
+Retorna 1 em caso de sucesso e 0 caso a instância esteja vazia ou seja maior que a capacidade do espaço de trabalho.*/
+int resolverTSP(Ponto pontos[], int tam, int ciclo[], double *custo, EspacoTrabalho *espaco){
+
+    if(!calcularAGM(pontos, tam, 0, espaco))        //Passo 1 e 2. Computar a AGM diretamente sobre as distâncias euclidianas.
+        return 0;
+
+    gerarCiclo(espaco, tam, 0, ciclo);              //Passo 3. Computar o ciclo usando Busca em Profundidade.
+    *custo = calcularCustoCiclo(pontos, ciclo, tam);
+
+    //O vetor visitados já não é usado pela AGM e serve de rascunho para a validação (apenas em builds de depuração).
+    assert(validarCiclo(ciclo, tam, tam, espaco->visitados));
+
+    return 1;
+
+}
+
+/*Função que utiliza o algoritmo de Prim em sua versão densa para computar a AGM do grafo completo implícito dos pontos. Como todo par
+de pontos é uma aresta, escolher o menor custo por varredura linear (O(n²) no total) é mais barato que usar o HEAP mínimo e dispensa
+guardar as n² arestas. O resultado fica nos vetores prodecessores e custos do espaço de trabalho, e os filhos de cada vértice são
+agrupados em inicioFilhos e filhos. Retorna 1 em caso de sucesso e 0 caso a instância esteja vazia ou não caiba no espaço de trabalho.*/
+int calcularAGM(Ponto pontos[], int tam, int raiz, EspacoTrabalho *espaco){
+
+    int *prodecessores = espaco->prodecessores, *inicioFilhos = espaco->inicioFilhos, *proximaPosicao = espaco->pilha;
+    double *custos = espaco->custos;
+    char *visitados = espaco->visitados;
+    int atual = raiz;
+
+    if(tam < 1 || tam > espaco->capacidade || raiz < 0 || raiz >= tam)
+        return 0;
+
+    for(int i = 0; i < tam; i++){
+
+        custos[i] = DBL_MAX;
+        prodecessores[i] = -1;
+        visitados[i] = 0;
+
+    }
+
+    custos[raiz] = 0;
+
+    for(int inseridos = 1; inseridos <= tam; inseridos++){
+
+        int proximo = -1;
+
+        visitados[atual] = 1;
+
+        for(int v = 0; v < tam; v++){
+
+            if(visitados[v])
+                continue;
+
+            double distancia = calcularDistanciaPontos(pontos[atual], pontos[v]);
+
+            if(distancia < custos[v]){
+
+                custos[v] = distancia;
+                prodecessores[v] = atual;
+
+            }
+
+            if(proximo < 0 || custos[v] < custos[proximo])
+                proximo = v;
+
+        }
+
+        atual = proximo;
+
+    }
+
+    //Agrupa os filhos de cada vértice (contagem seguida de soma de prefixos), mantendo-os em ordem crescente.
+    for(int i = 0; i <= tam; i++)
+        inicioFilhos[i] = 0;
+
+    for(int i = 0; i < tam; i++)
+        if(prodecessores[i] >= 0)
+            inicioFilhos[prodecessores[i] + 1]++;
+
+    for(int i = 0; i < tam; i++)
+        inicioFilhos[i + 1] += inicioFilhos[i];
+
+    //A pilha ainda não está em uso, então serve como vetor da próxima posição livre de cada vértice.
+    for(int i = 0; i < tam; i++)
+        proximaPosicao[i] = inicioFilhos[i];
+
+    for(int i = 0; i < tam; i++)
+        if(prodecessores[i] >= 0)
+            espaco->filhos[proximaPosicao[prodecessores[i]]++] = i;
+
+    return 1;
+
+}
+
+/*Função que gera o ciclo a partir da AGM guardada no espaço de trabalho por calcularAGM(). A busca em profundidade é feita com uma
+pilha explícita em vez de recursão, então não depende do tamanho da pilha da thread. Os filhos são visitados do maior para o menor,
+a mesma ordem em que buscaProfundidade() percorre a lista de adjacências montada pelo prim(). O ciclo recebe tam + 1 vértices (o
+último repete a raíz). Retorna o número de vértices visitados.*/
+int gerarCiclo(EspacoTrabalho *espaco, int tam, int raiz, int ciclo[]){
+
+    int *pilha = espaco->pilha, topo = 0, itr = 0;
+
+    pilha[topo++] = raiz;
+
+    while(topo > 0){
+
+        int vertice = pilha[--topo];
+
+        ciclo[itr++] = vertice;
+
+        for(int i = espaco->inicioFilhos[vertice]; i < espaco->inicioFilhos[vertice + 1]; i++)
+            pilha[topo++] = espaco->filhos[i];
+
+    }
+
+    ciclo[tam] = raiz;
+
+    return itr;
+
+}
+
 /*Função que inicializa os valores do HEAP mínimo, custos e prodecessores para serem usados no PRIM. Inicialmente todos os vértices possuem
 custo infinito e prodecessores iguais a -1.*/
-void inicializarPrim(HeapMinimo *heapMinimo, double custos[], int prodecessores[], int tam){
+static void inicializarPrim(HeapMinimo *heapMinimo, double custos[], int prodecessores[], int tam){
 
     for(int i = 0; i < tam; i++){
 
@@ -289,15 +393,17 @@ elemento do ciclo é o vértice escolhido como raíz (usado no PRIM), assim como
 não visitados através da função marcarNaoVisitados() e, por fim, a função retorna o vetor que representa o ciclo.*/
 int *buscaProfundidade(Grafo *agm, int vertice){
 
-    int *ciclo, itr = 1, visitados[agm->vertices];
+    int *ciclo, itr = 1, *visitados;
 
     ciclo = malloc ((agm->vertices + 1) * sizeof (int));
+    visitados = (int *) malloc (agm->vertices * sizeof (int));
 
     marcarNaoVisitados(visitados, agm->vertices);
     
     ciclo[0] = vertice;
     buscaProfundidadeAuxiliar(agm, vertice, ciclo, &itr, visitados);
     ciclo[agm->vertices] = vertice;
+    free(visitados);
     
     return ciclo;
 
@@ -307,7 +413,7 @@ int *buscaProfundidade(Grafo *agm, int vertice){
 um vetor de vértices já visitados como entrada. Para cada vértice adjacente ao vértice de entrada, caso ele não tenha sido visitado,
 o adiciona no vetor de ciclo e chama a própria função recursivamente. O vetor de ciclo é preenchido por referência, a função possui
 retorno void.*/
-void buscaProfundidadeAuxiliar(Grafo *agm, int vertice, int ciclo[], int *itr, int visitados[]){
+static void buscaProfundidadeAuxiliar(Grafo *agm, int vertice, int ciclo[], int *itr, int visitados[]){
 
     visitados[vertice] = 1;
 
@@ -325,64 +431,11 @@ void buscaProfundidadeAuxiliar(Grafo *agm, int vertice, int ciclo[], int *itr, i
 
 }
 
-/*Função que calcula o custo total do ciclo. Possui um vetor de pontos, um vetor de ciclo e um tamanho como entrada. Para cada vértice
-armazenado no vetor do ciclo, calcula sua distância euclidiana com relação ao próximo ponto do ciclo. Para o penúltimo ponto, calcula
-a distância entre ele e o primeiro ponto. Retorna o custo total do ciclo.*/
+/*Função que calcula o custo total do ciclo. Mantida por compatibilidade: apenas repassa para calcularCustoCiclo(), que usa as tam
+primeiras posições do ciclo (o ciclo fechado gerado pela busca em profundidade tem tam + 1) e faz a soma compensada.*/
 double calcularCustoTotal(Ponto pontos[], int ciclo[], int tam){
 
-    double custoTotal = 0;
-
-    for(int i = 0; i < tam - 1; i++)
-        custoTotal += calcularDistanciaPontos(pontos[ciclo[i]], pontos[ciclo[i + 1]]);
-
-    custoTotal += calcularDistanciaPontos(pontos[ciclo[(tam - 1)]], pontos[ciclo[0]]);
-
-    return custoTotal;
-
-}
-
-/*Função que exporta os pontos pertencentes ao ciclo em um arquivo "cycle.txt".*/
-void exportarCiclo(int ciclo[], Ponto *pontos, int tam){
-
-    FILE *arquivo;
-
-    arquivo = fopen("cycle.txt", "w");
-
-    if(arquivo == NULL){
-
-        printf("ERRO AO ABRIR O ARQUIVO.\n");
-        getchar();
-        exit(1);
-
-    }
-
-    for(int i = 0; i <= tam; i++)
-        fprintf(arquivo, "%d %d\n", (int) pontos[ciclo[i]].x, (int) pontos[ciclo[i]].y);   
-
-    fclose(arquivo);
- 
-}
-
-/*Função que exporta os pontos da AGM criada em um arquivo "tree.txt".*/
-void exportarAGM(Grafo *agm, Ponto pontos[]){
-
-    FILE *arquivo;
-
-    arquivo = fopen("tree.txt", "w");
-
-    if(arquivo == NULL){
-
-        printf("ERRO AO ABRIR O ARQUIVO.\n");
-        getchar();
-        exit(1);
-
-    }
-
-    for(int i = 0; i < agm->vertices; i++)
-        for(No *aux = agm->adjacencias[i]; aux != NULL; aux = aux->proximo)
-            fprintf(arquivo, "%d %d\n%d %d\n", (int) pontos[i].x, (int) pontos[i].y, (int) pontos[aux->id].x, (int) pontos[aux->id].y);
-
-    fclose(arquivo);
+    return calcularCustoCiclo(pontos, ciclo, tam);
 
 }
 
@@ -394,21 +447,21 @@ double calcularDistanciaPontos(Ponto p1, Ponto p2){
 }
 
 /*Função que retorna a posição do pai de um elemento no HEAP mínimo.*/
-int pai(int i){
+static int pai(int i){
 
     return (i - 1) / 2;
 
 }
 
 /*Função que retorna a posição do filho da esquerda em um HEAP mínimo.*/
-int filhoEsquerda(int i){
+static int filhoEsquerda(int i){
 
     return (i * 2) + 1;
 
 }
 
 /*Função que retorna a posição do filho da direita em um HEAP mínimo.*/
-int filhoDireita(int i){
+static int filhoDireita(int i){
 
     return (i * 2) + 2;
 
@@ -416,7 +469,7 @@ int filhoDireita(int i){
 
 /*Função que aloca o HEAP mínimo e seus respectivos atributos do tipo ponteiro (posicoes e valores). Possui um inteiro como entrada para
 representar o tamanho do HEAP mínimo. Retorna um ponteiro para HEAP mínimo.*/
-HeapMinimo *criarHeapMinimo(int tam){
+static HeapMinimo *criarHeapMinimo(int tam){
 
     HeapMinimo *heapMinimo;
 
@@ -430,7 +483,7 @@ HeapMinimo *criarHeapMinimo(int tam){
 }
 
 /*Função que desaloca o heapMínimo e seus respectivos atributos do tipo ponteiro (posicoes e valores).*/
-void destruirHeapMinimo(HeapMinimo *heapMinimo){
+static void destruirHeapMinimo(HeapMinimo *heapMinimo){
 
     free(heapMinimo->valores);
     free(heapMinimo->posicoes);
@@ -439,7 +492,7 @@ void destruirHeapMinimo(HeapMinimo *heapMinimo){
 }
 
 /*Função que atualiza o HEAP mínimo para garantir a árvore.*/
-void atualizarHeapMinimo(HeapMinimo *heapMinimo, int i){
+static void atualizarHeapMinimo(HeapMinimo *heapMinimo, int i){
 
     int esquerda = filhoEsquerda(i);
     int direita = filhoDireita(i);
@@ -470,7 +523,7 @@ void atualizarHeapMinimo(HeapMinimo *heapMinimo, int i){
 }
 
 /*Função que troca os valores das posições A e B em um HEAP mínimo.*/
-void trocar(HeapMinimo *heapMinimo, int a, int b){
+static void trocar(HeapMinimo *heapMinimo, int a, int b){
 
     VerticeCusto aux = heapMinimo->valores[a];
     heapMinimo->valores[a] = heapMinimo->valores[b];
@@ -479,7 +532,7 @@ void trocar(HeapMinimo *heapMinimo, int a, int b){
 }
 
 /*Função que ordena o HEAP mínimo.*/
-void construirHeapMinimo(HeapMinimo *heapMinimo){
+static void construirHeapMinimo(HeapMinimo *heapMinimo){
 
     for(int i = 0; i < heapMinimo->tamanho / 2; i++)
         atualizarHeapMinimo(heapMinimo, i);
@@ -488,13 +541,14 @@ void construirHeapMinimo(HeapMinimo *heapMinimo){
 
 /*Função que extrai o menor custo do HEAP mínimo e já o atualiza. A função também reduz o tamanho do HEAP (número de vértices atuais no
 HEAP). Também é atualizado o vetor de posições do HEAP mínimo, a posição do elemento retirado recebe o tamanho - 1 do HEAP. Dessa forma,
-não é preciso percorrer todo o HEAP para verificar se um elemento existe, apenas é verificada a posição deste.*/
-VerticeCusto extrairMinimo(HeapMinimo *heapMinimo){
+não é preciso percorrer todo o HEAP para verificar se um elemento existe, apenas é verificada a posição deste. Com o HEAP vazio, retorna
+o vértice -1 com custo infinito.*/
+static VerticeCusto extrairMinimo(HeapMinimo *heapMinimo){
 
-    VerticeCusto verticeCusto;
+    VerticeCusto verticeCusto = {-1, DBL_MAX};
 
     if(heapMinimo->tamanho < 1)
-        printf("Erro: heap underflow\n");
+        return verticeCusto;
 
     verticeCusto = heapMinimo->valores[0];
 
@@ -509,14 +563,11 @@ VerticeCusto extrairMinimo(HeapMinimo *heapMinimo){
 
 }
 
-/*Função que diminui o valor de uma chave e reajusta o HEAP mínimo.*/
-void diminuirValorChave(HeapMinimo *heapMinimo, int i, double chave){
+/*Função que diminui o valor de uma chave e reajusta o HEAP mínimo. Uma chave maior que a atual é ignorada.*/
+static void diminuirValorChave(HeapMinimo *heapMinimo, int i, double chave){
 
-    if(chave > heapMinimo->valores[i].custo){
-        
-        printf("Erro: chave maior que o atual\n");
+    if(chave > heapMinimo->valores[i].custo)
         return;
-    }
 
     heapMinimo->valores[i].custo = chave;
 
@@ -535,40 +586,23 @@ void diminuirValorChave(HeapMinimo *heapMinimo, int i, double chave){
 /*Função que verifica se existe um vertice no HEAP mínimo. Para diminuir a complexidade do algoritmo, em vez de percorrer todo o HEAP
 mínimo para verificar se um vértice pertence a ele, apenas é verificado se a posição do vértice é menor do que o número de vértices 
 atuais no HEAP. Se sim, então ele existe, caso contrário, não existe.*/
-int existe(HeapMinimo *heapMinimo, int vertice){
+static int existe(HeapMinimo *heapMinimo, int vertice){
 
     return (heapMinimo->posicoes[vertice] < heapMinimo->tamanho) ? 1 : 0;
 
 }
 
 /*Função que verifica se o HEAP mínimo está vazio.*/
-int vazio(HeapMinimo *heapMinimo){
+static int vazio(HeapMinimo *heapMinimo){
 
     return (heapMinimo->tamanho <= 0) ? 1 : 0;
 
 }
 
 /*Função para preencher o vetor que indica os vertices visitados.*/
-void marcarNaoVisitados(int visitados[], int tam){
+static void marcarNaoVisitados(int visitados[], int tam){
 
     for(int i = 0; i < tam; i++)
         visitados[i] = 0;
 
 }
-
-/*Função que imprime o custo total do ciclo.*/
-void imprimirCustoTotal(clock_t inicio, Ponto pontos[], int ciclo[], int tam){
-
-    printf("%.6f %.6f\n", (clock() - inicio) / (double)CLOCKS_PER_SEC, calcularCustoTotal(pontos, ciclo, tam));
-   
-}
-
-/*Função que libera as estruturas utilizadas pelo programa da memória.*/
-void destruirEstruturas(int ciclo[], Ponto pontos[], Grafo *grafo, Grafo *agm){
-
-    free(ciclo);
-    free(pontos);
-    destruirGrafo(agm);
-    destruirGrafo(grafo);
-
-}
\ No newline at end of file
@@ -0,0 +1,128 @@
+/*
+    Disciplina: Projeto e Análise de Algoritmos
+    Turma: S73
+    UTFPR - Curitiba
+
+    Alunos:
+        Diego Henrique Arenas Okawa - 2127890
+        Louis Brommelstroet - 2127997
+        Ellejeane Camila Marques Ferreira dos Santos - 1904965
+*/
+
+#ifndef TSP_H
+#define TSP_H
+
+/*Estrutura que define um nó do grafo.*/
+typedef struct no {
+
+    int id; //Número do vértice.
+    double peso; //Peso da aresta.
+    struct no *proximo; //Ponteiro para o próximo nó.
+
+} No;
+
+/*Estrutura que representa o grafo.*/
+typedef struct grafo {
+
+    int arestas; //Número de arestas do grafo.
+    int vertices; //Número de vértices do grafo.
+    No **adjacencias; //Lista de adjacências do grafo.
+
+} Grafo;
+
+/*Estrutura que representa um ponto no plano cartesiano.*/
+typedef struct ponto {
+
+    double x; //Valor correspondente ao eixo X.
+    double y; //Valor correspondente ao eixo Y.
+
+} Ponto;
+
+/*Estrutura que guarda todos os vetores auxiliares usados para resolver uma instância a partir de um vetor de pontos. É criada uma única
+vez pelo chamador com a maior quantidade de pontos esperada e pode ser reutilizada em chamadas sucessivas sem nenhuma nova alocação. Cada
+thread deve usar o seu próprio espaço de trabalho.*/
+typedef struct espacoTrabalho {
+
+    int capacidade; //Maior número de pontos suportado.
+    int *prodecessores; //Prodecessor de cada vértice na AGM (-1 para a raíz).
+    double *custos; //Custo da aresta que liga cada vértice ao seu prodecessor na AGM.
+    char *visitados; //Marca os vértices já inseridos na AGM.
+    int *inicioFilhos; //Posição em filhos onde começam os filhos de cada vértice (capacidade + 1 posições).
+    int *filhos; //Filhos de cada vértice na AGM, agrupados por prodecessor em ordem crescente.
+    int *pilha; //Pilha usada na busca em profundidade iterativa.
+
+} EspacoTrabalho;
+
+/*Estrutura que representa uma grade uniforme de células (buckets) sobre as cidades ativas de uma instância, usada para procurar cidades
+próximas sem percorrer todas. As cidades de cada célula formam uma lista duplamente encadeada indexada pelo identificador.*/
+typedef struct grade {
+
+    double x; //Coordenada X do canto inferior esquerdo da grade.
+    double y; //Coordenada Y do canto inferior esquerdo da grade.
+    double lado; //Lado de cada célula.
+    int colunas; //Número de células no eixo X.
+    int linhas; //Número de células no eixo Y.
+    int construida; //Número de cidades ativas quando a grade foi construída.
+    int capacidadeCelulas; //Número de posições alocadas para celulas.
+    int *celulas; //Primeira cidade de cada célula (-1 para célula vazia).
+    int *proximos; //Próxima cidade na mesma célula (-1 no fim da lista).
+    int *anteriores; //Cidade anterior na mesma célula (-1 no início da lista).
+
+} Grade;
+
+/*Estrutura que mantém uma instância já resolvida em memória para permitir inserir e remover cidades sem refazer todo o cálculo.
+Os identificadores das cidades são estáveis: uma cidade removida deixa sua posição inativa e novas cidades recebem novos identificadores.*/
+typedef struct instancia {
+
+    int tam; //Número de cidades ativas.
+    int total; //Número de identificadores já utilizados (cidades ativas e removidas).
+    int capacidade; //Número de posições alocadas para pontos, ativos e ciclo.
+    Ponto *pontos; //Coordenadas de cada cidade, indexadas pelo identificador.
+    char *ativos; //Indica se a cidade de cada identificador ainda pertence à instância.
+    Grafo *agm; //Árvore geradora mínima das cidades ativas.
+    int *ciclo; //Ciclo atual com tam + 1 posições (a última repete a primeira).
+    double custo; //Custo total do ciclo atual.
+    int *rascunho; //Vetor auxiliar com 4 * capacidade posições, usado nas atualizações da AGM.
+    double *rascunhoPesos; //Vetor auxiliar com 2 * capacidade posições, usado nas atualizações da AGM.
+    Grade grade; //Grade de células das cidades ativas, usada para religar a AGM após uma remoção.
+
+} Instancia;
+
+/*Funções exportadas pela biblioteca. As demais funções (grafos, HEAP mínimo e busca em profundidade) são internas e ficam ocultas na
+libtsp.so e locais na libtsp.a, para não colidirem com símbolos do programa que usa a biblioteca.*/
+
+#if defined(__GNUC__)
+#define TSP_API __attribute__((visibility("default")))
+#else
+#define TSP_API
+#endif
+
+/*Funções para pontos.*/
+
+TSP_API double calcularDistanciaPontos(Ponto p1, Ponto p2);
+
+/*Funções para resolver a partir de um vetor de pontos.*/
+
+TSP_API int calcularAGM(Ponto pontos[], int tam, int raiz, EspacoTrabalho *espaco);
+TSP_API int gerarCiclo(EspacoTrabalho *espaco, int tam, int raiz, int ciclo[]);
+TSP_API int resolverTSP(Ponto pontos[], int tam, int ciclo[], double *custo, EspacoTrabalho *espaco);
+TSP_API void destruirEspacoTrabalho(EspacoTrabalho *espaco);
+TSP_API EspacoTrabalho *criarEspacoTrabalho(int capacidade);
+
+/*Funções para avaliação de ciclos.*/
+
+TSP_API int validarCiclo(int ciclo[], int tam, int vertices, char marcas[]);
+TSP_API double calcularCustoCiclo(Ponto pontos[], int ciclo[], int tam);
+TSP_API double calcularCustoTotal(Ponto pontos[], int ciclo[], int tam);
+TSP_API double deltaDoisOpt(Ponto pontos[], int ciclo[], int tam, int i, int j);
+TSP_API double deltaOrOpt(Ponto pontos[], int ciclo[], int tam, int i, int comprimento, int j, int invertido);
+TSP_API double deltaTroca(Ponto pontos[], int ciclo[], int tam, int i, int j);
+
+/*Funções para instâncias incrementais.*/
+
+TSP_API int adicionarCidade(Instancia *instancia, Ponto ponto);
+TSP_API int removerCidade(Instancia *instancia, int id);
+TSP_API void destruirInstancia(Instancia *instancia);
+TSP_API Instancia *criarInstancia(Ponto pontos[], int tam);
+
+#endif
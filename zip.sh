@@ -2,6 +2,6 @@ sudo apt install -y zip
 ra="./2127890_2127997_1904965"
 rm -rf "$ra.zip" $ra
 mkdir $ra
-cp Makefile tsp.c "$ra/"
+cp Makefile tsp.h grafo.h tsp.c instancia.c avaliacao.c main.c testes.c genpoints.c "$ra/"
 zip "$ra.zip" -r $ra
 rm -rf $ra
\ No newline at end of file